@@ -10,6 +10,8 @@
 namespace IceInternal
 {
 
+class BufferPool;
+
 class ICE_API Buffer : private IceUtil::noncopyable
 {
 public:
@@ -78,6 +80,16 @@ public:
 
         void clear();
 
+        //
+        // Allocate the buffer memory from the given pool instead of the heap.
+        // Pooled buffers are allocated with malloc, the pool and the heap
+        // buffers can be freely exchanged between containers.
+        //
+        void setPool(BufferPool* pool)
+        {
+            _pool = pool;
+        }
+
         void resize(size_type n) // Inlined for performance reasons.
         {
             if(n == 0)
@@ -143,6 +155,7 @@ public:
         size_type _capacity;
         int _shrinkCounter;
         bool _owned;
+        BufferPool* _pool;
     };
 
     Container b;
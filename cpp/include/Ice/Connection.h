@@ -38,6 +38,8 @@ class IPConnectionInfo;
 class TCPConnectionInfo;
 class UDPConnectionInfo;
 class WSConnectionInfo;
+class UNIXConnectionInfo;
+class SHMConnectionInfo;
 
 }
 
@@ -669,6 +671,123 @@ public:
     ::Ice::HeaderDict headers;
 };
 
+/**
+ * Provides access to the connection details of a Unix domain socket connection. The process, user and group IDs are
+ * the credentials of the peer process, as reported by the operating system when the connection was established. They
+ * are set to -1 if the platform doesn't provide some of the credentials.
+ * \headerfile Ice/Ice.h
+ */
+class ICE_CLASS(ICE_API) UNIXConnectionInfo : public ::Ice::ConnectionInfo
+{
+public:
+
+    ICE_MEMBER(ICE_API) virtual ~UNIXConnectionInfo();
+
+    UNIXConnectionInfo() :
+        pid(-1),
+        uid(-1),
+        gid(-1),
+        rcvSize(0),
+        sndSize(0)
+    {
+    }
+
+    UNIXConnectionInfo(const UNIXConnectionInfo&) = default;
+    UNIXConnectionInfo(UNIXConnectionInfo&&) = default;
+    UNIXConnectionInfo& operator=(const UNIXConnectionInfo&) = default;
+    UNIXConnectionInfo& operator=(UNIXConnectionInfo&&) = default;
+
+    /**
+     * One-shot constructor to initialize all data members.
+     * @param underlying The information of the underyling transport or null if there's no underlying transport.
+     * @param incoming Whether or not the connection is an incoming or outgoing connection.
+     * @param adapterName The name of the adapter associated with the connection.
+     * @param connectionId The connection id.
+     * @param path The file system path of the socket.
+     * @param pid The process ID of the peer.
+     * @param uid The user ID of the peer.
+     * @param gid The group ID of the peer.
+     * @param rcvSize The connection buffer receive size.
+     * @param sndSize The connection buffer send size.
+     */
+    UNIXConnectionInfo(const ::std::shared_ptr<::Ice::ConnectionInfo>& underlying, bool incoming, const ::std::string& adapterName, const ::std::string& connectionId, const ::std::string& path, int pid, int uid, int gid, int rcvSize, int sndSize) :
+        ConnectionInfo(underlying, incoming, adapterName, connectionId),
+        path(path),
+        pid(pid),
+        uid(uid),
+        gid(gid),
+        rcvSize(rcvSize),
+        sndSize(sndSize)
+    {
+    }
+
+    /**
+     * The file system path of the socket.
+     */
+    ::std::string path;
+    /**
+     * The process ID of the peer.
+     */
+    int pid = -1;
+    /**
+     * The user ID of the peer.
+     */
+    int uid = -1;
+    /**
+     * The group ID of the peer.
+     */
+    int gid = -1;
+    /**
+     * The connection buffer receive size.
+     */
+    int rcvSize = 0;
+    /**
+     * The connection buffer send size.
+     */
+    int sndSize = 0;
+};
+
+/**
+ * Provides access to the connection details of a shared memory connection. The underlying connection information
+ * provides the details of the Unix domain socket used to establish the connection.
+ * \headerfile Ice/Ice.h
+ */
+class ICE_CLASS(ICE_API) SHMConnectionInfo : public ::Ice::ConnectionInfo
+{
+public:
+
+    ICE_MEMBER(ICE_API) virtual ~SHMConnectionInfo();
+
+    SHMConnectionInfo() :
+        ringSize(0)
+    {
+    }
+
+    SHMConnectionInfo(const SHMConnectionInfo&) = default;
+    SHMConnectionInfo(SHMConnectionInfo&&) = default;
+    SHMConnectionInfo& operator=(const SHMConnectionInfo&) = default;
+    SHMConnectionInfo& operator=(SHMConnectionInfo&&) = default;
+
+    /**
+     * One-shot constructor to initialize all data members.
+     * @param underlying The information of the underyling transport or null if there's no underlying transport.
+     * @param incoming Whether or not the connection is an incoming or outgoing connection.
+     * @param adapterName The name of the adapter associated with the connection.
+     * @param connectionId The connection id.
+     * @param ringSize The size in bytes of the ring buffer used for each direction.
+     */
+    SHMConnectionInfo(const ::std::shared_ptr<::Ice::ConnectionInfo>& underlying, bool incoming, const ::std::string& adapterName, const ::std::string& connectionId, int ringSize) :
+        ConnectionInfo(underlying, incoming, adapterName, connectionId),
+        ringSize(ringSize)
+    {
+    }
+
+    /**
+     * The size in bytes of the ring buffer used for each direction.
+     */
+    int ringSize = 0;
+};
+
 }
 
 /// \cond INTERNAL
@@ -687,6 +806,10 @@ using UDPConnectionInfoPtr = ::std::shared_ptr<UDPConnectionInfo>;
 
 using WSConnectionInfoPtr = ::std::shared_ptr<WSConnectionInfo>;
 
+using UNIXConnectionInfoPtr = ::std::shared_ptr<UNIXConnectionInfo>;
+
+using SHMConnectionInfoPtr = ::std::shared_ptr<SHMConnectionInfo>;
+
 }
 /// \endcond
 
@@ -30,6 +30,8 @@ namespace Ice
 
 class ConnectionInfo;
 class WSConnectionInfo;
+class UNIXConnectionInfo;
+class SHMConnectionInfo;
 class Connection;
 
 }
@@ -40,6 +42,8 @@ namespace Ice
 
 using ConnectionInfoPtr = ::std::shared_ptr<ConnectionInfo>;
 using WSConnectionInfoPtr = ::std::shared_ptr<WSConnectionInfo>;
+using UNIXConnectionInfoPtr = ::std::shared_ptr<UNIXConnectionInfo>;
+using SHMConnectionInfoPtr = ::std::shared_ptr<SHMConnectionInfo>;
 using ConnectionPtr = ::std::shared_ptr<Connection>;
 
 }
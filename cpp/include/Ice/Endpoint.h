@@ -37,6 +37,8 @@ class IPEndpointInfo;
 class TCPEndpointInfo;
 class UDPEndpointInfo;
 class WSEndpointInfo;
+class UNIXEndpointInfo;
+class SHMEndpointInfo;
 class OpaqueEndpointInfo;
 
 }
@@ -295,6 +297,74 @@ public:
     ::std::string resource;
 };
 
+/**
+ * Provides access to a Unix domain socket endpoint information.
+ * @see Endpoint
+ * \headerfile Ice/Ice.h
+ */
+class ICE_CLASS(ICE_API) UNIXEndpointInfo : public ::Ice::EndpointInfo
+{
+public:
+
+    ICE_MEMBER(ICE_API) virtual ~UNIXEndpointInfo();
+
+    UNIXEndpointInfo() = default;
+
+    UNIXEndpointInfo(const UNIXEndpointInfo&) = default;
+    UNIXEndpointInfo(UNIXEndpointInfo&&) = default;
+    UNIXEndpointInfo& operator=(const UNIXEndpointInfo&) = default;
+    UNIXEndpointInfo& operator=(UNIXEndpointInfo&&) = default;
+
+    /**
+     * One-shot constructor to initialize all data members.
+     * @param underlying The information of the underyling endpoint or null if there's no underlying endpoint.
+     * @param timeout The timeout for the endpoint in milliseconds.
+     * @param compress Specifies whether or not compression should be used if available when using this endpoint.
+     * @param path The file system path of the socket configured with the endpoint.
+     */
+    UNIXEndpointInfo(const ::std::shared_ptr<::Ice::EndpointInfo>& underlying, int timeout, bool compress, const ::std::string& path) :
+        EndpointInfo(underlying, timeout, compress),
+        path(path)
+    {
+    }
+
+    /**
+     * The file system path of the socket configured with the endpoint.
+     */
+    ::std::string path;
+};
+
+/**
+ * Provides access to a shared memory endpoint information. The underlying endpoint information provides the path of
+ * the Unix domain socket used to establish connections.
+ * @see Endpoint
+ * \headerfile Ice/Ice.h
+ */
+class ICE_CLASS(ICE_API) SHMEndpointInfo : public ::Ice::EndpointInfo
+{
+public:
+
+    ICE_MEMBER(ICE_API) virtual ~SHMEndpointInfo();
+
+    SHMEndpointInfo() = default;
+
+    SHMEndpointInfo(const SHMEndpointInfo&) = default;
+    SHMEndpointInfo(SHMEndpointInfo&&) = default;
+    SHMEndpointInfo& operator=(const SHMEndpointInfo&) = default;
+    SHMEndpointInfo& operator=(SHMEndpointInfo&&) = default;
+
+    /**
+     * One-shot constructor to initialize all data members.
+     * @param underlying The information of the underyling endpoint or null if there's no underlying endpoint.
+     * @param timeout The timeout for the endpoint in milliseconds.
+     * @param compress Specifies whether or not compression should be used if available when using this endpoint.
+     */
+    SHMEndpointInfo(const ::std::shared_ptr<::Ice::EndpointInfo>& underlying, int timeout, bool compress) :
+        EndpointInfo(underlying, timeout, compress)
+    {
+    }
+};
+
 /**
  * Provides access to the details of an opaque endpoint.
  * @see Endpoint
@@ -363,6 +433,10 @@ using UDPEndpointInfoPtr = ::std::shared_ptr<UDPEndpointInfo>;
 
 using WSEndpointInfoPtr = ::std::shared_ptr<WSEndpointInfo>;
 
+using UNIXEndpointInfoPtr = ::std::shared_ptr<UNIXEndpointInfo>;
+
+using SHMEndpointInfoPtr = ::std::shared_ptr<SHMEndpointInfo>;
+
 using OpaqueEndpointInfoPtr = ::std::shared_ptr<OpaqueEndpointInfo>;
 
 }
@@ -33,6 +33,8 @@ class IPEndpointInfo;
 class TCPEndpointInfo;
 class UDPEndpointInfo;
 class WSEndpointInfo;
+class UNIXEndpointInfo;
+class SHMEndpointInfo;
 class Endpoint;
 
 }
@@ -68,6 +70,10 @@ using UDPEndpointInfoPtr = ::std::shared_ptr<UDPEndpointInfo>;
 
 using WSEndpointInfoPtr = ::std::shared_ptr<WSEndpointInfo>;
 
+using UNIXEndpointInfoPtr = ::std::shared_ptr<UNIXEndpointInfo>;
+
+using SHMEndpointInfoPtr = ::std::shared_ptr<SHMEndpointInfo>;
+
 using EndpointPtr = ::std::shared_ptr<Endpoint>;
 
 }
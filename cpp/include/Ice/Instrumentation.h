@@ -145,6 +145,20 @@ public:
      * @param newState The new thread state.
      */
     virtual void stateChanged(ThreadState oldState, ThreadState newState) = 0;
+
+    /**
+     * Notification of a thread pool thread waiting for events with busy polling enabled.
+     * @param spinTime The time spent polling without blocking, in microseconds.
+     * @param blockedTime The time spent blocked once busy polling timed out, in microseconds.
+     */
+    virtual void busyPoll(std::int64_t spinTime, std::int64_t blockedTime) = 0;
+
+    /**
+     * Notification of stream buffer allocations by a thread pool thread with the buffer pool enabled.
+     * @param hits The number of buffers allocated from the buffer pool since the last notification.
+     * @param misses The number of buffers allocated from the heap since the last notification.
+     */
+    virtual void bufferPool(std::int32_t hits, std::int32_t misses) = 0;
 };
 
 /**
@@ -168,6 +182,14 @@ public:
      * @param num The number of bytes received.
      */
     virtual void receivedBytes(int num) = 0;
+
+    /**
+     * Notification of a message compressed or uncompressed by the connection.
+     * @param savedBytes The number of bytes saved by the compression, 0 if the message was sent uncompressed
+     * because compression didn't reduce its size.
+     * @param time The time spent compressing or uncompressing the message, in microseconds.
+     */
+    virtual void compression(int savedBytes, std::int64_t time) = 0;
 };
 
 /**
@@ -9,10 +9,12 @@
 
 #include <set>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <chrono>
 #include <functional>
 #include <optional>
+#include <vector>
 
 namespace IceUtil
 {
@@ -37,7 +39,14 @@ class ICE_API Timer
 public:
 
     Timer();
-    virtual ~Timer() = default;
+
+    // Construct a timer that keeps its tasks in hierarchical timing wheels instead of a sorted set: scheduling and
+    // cancelling a task are constant time operations, at the cost of a 1ms resolution. The tasks are spread over the
+    // given number of shards, each shard has its own lock and its own thread. With several shards, tasks assigned to
+    // different shards can execute concurrently.
+    explicit Timer(int shards);
+
+    virtual ~Timer();
 
     // Destroy the timer and detach its execution thread if the calling thread
     // is the timer thread, join the timer execution thread otherwise.
@@ -47,70 +56,14 @@ public:
     template<class Rep, class Period>
     void schedule(const TimerTaskPtr& task, const std::chrono::duration<Rep, Period>& delay)
     {
-        std::lock_guard lock(_mutex);
-        if (_destroyed)
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "timer destroyed");
-        }
-
-        if (delay < std::chrono::nanoseconds::zero())
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "invalid negative delay");
-        }
-
-        auto now = std::chrono::steady_clock::now();
-        auto time = now + delay;
-        if (delay > std::chrono::nanoseconds::zero() && time < now)
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "delay too large, resulting in overflow");
-        }
-
-        bool inserted = _tasks.insert(make_pair(task, time)).second;
-        if (!inserted)
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "task is already scheduled");
-        }
-        _tokens.insert({ time, std::nullopt, task });
-
-        if(_wakeUpTime == std::chrono::steady_clock::time_point() || time < _wakeUpTime)
-        {
-            _condition.notify_one();
-        }
+        scheduleTask(task, checkDelay(delay), std::nullopt);
     }
 
     // Schedule a task for repeated execution with the given delay between each execution.
     template<class Rep, class Period>
     void scheduleRepeated(TimerTaskPtr task, const std::chrono::duration<Rep, Period>& delay)
     {
-        std::lock_guard lock(_mutex);
-        if (_destroyed)
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "timer destroyed");
-        }
-
-        if (delay < std::chrono::nanoseconds::zero())
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "invalid negative delay");
-        }
-
-        auto now = std::chrono::steady_clock::now();
-        auto time = now + delay;
-        if (delay > std::chrono::nanoseconds::zero() && time < now)
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "delay too large, resulting in overflow");
-        }
-
-        bool inserted = _tasks.insert(make_pair(task, time)).second;
-        if(!inserted)
-        {
-            throw IllegalArgumentException(__FILE__, __LINE__, "task is already scheduled");
-        }
-        _tokens.insert({ time, std::chrono::duration_cast<std::chrono::nanoseconds>(delay), task });
-
-        if(_wakeUpTime == std::chrono::steady_clock::time_point() || time < _wakeUpTime)
-        {
-            _condition.notify_one();
-        }
+        scheduleTask(task, checkDelay(delay), std::chrono::duration_cast<std::chrono::nanoseconds>(delay));
     }
 
     //
@@ -127,6 +80,29 @@ protected:
 
 private:
 
+    class Wheel;
+
+    template<class Rep, class Period>
+    static std::chrono::steady_clock::time_point checkDelay(const std::chrono::duration<Rep, Period>& delay)
+    {
+        if (delay < std::chrono::nanoseconds::zero())
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "invalid negative delay");
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        auto time = now + delay;
+        if (delay > std::chrono::nanoseconds::zero() && time < now)
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "delay too large, resulting in overflow");
+        }
+        return time;
+    }
+
+    void scheduleTask(const TimerTaskPtr&, std::chrono::steady_clock::time_point,
+                      std::optional<std::chrono::nanoseconds>);
+    void execute(const TimerTaskPtr&);
+
     struct Token
     {
         std::chrono::steady_clock::time_point scheduledTime;
@@ -155,6 +131,7 @@ private:
     bool _destroyed;
     std::chrono::steady_clock::time_point _wakeUpTime;
     std::thread _worker;
+    std::vector<std::unique_ptr<Wheel>> _wheels; // The timing wheel shards, empty if the tasks are kept in _tokens.
 };
 
 }
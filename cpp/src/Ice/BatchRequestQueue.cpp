@@ -4,6 +4,7 @@
 
 #include <Ice/BatchRequestQueue.h>
 #include <Ice/Instance.h>
+#include <Ice/LocalException.h>
 #include <Ice/Properties.h>
 #include <Ice/Reference.h>
 #include "Ice/Proxy.h"
@@ -58,20 +59,61 @@ private:
     const int _size;
 };
 
+
+class BatchFlushTimerTask : public IceUtil::TimerTask
+{
+public:
+
+    BatchFlushTimerTask(const Ice::ObjectPrx& proxy) : _proxy(proxy)
+    {
+    }
+
+    virtual void
+    runTimerTask()
+    {
+        //
+        // Exceptions are reported to the flush future, which isn't waited on like
+        // for the flushes triggered by the batch auto-flush size.
+        //
+        _proxy->ice_flushBatchRequestsAsync();
+    }
+
+private:
+
+    const Ice::ObjectPrx _proxy;
+};
+
+}
+
+BatchRequestQueue::Batch::Batch(Instance* instance) :
+    stream(instance, Ice::currentProtocolEncoding),
+    inUse(false),
+    canFlush(false),
+    compress(false),
+    requestNum(0)
+{
+    stream.writeBlob(requestBatchHdr, sizeof(requestBatchHdr));
+    marker = stream.b.size();
 }
 
-BatchRequestQueue::BatchRequestQueue(const InstancePtr& instance, bool datagram) :
+BatchRequestQueue::BatchRequestQueue(const InstancePtr& instance, bool datagram, size_t maxSize, int flushDelay) :
     _interceptor(instance->initializationData().batchRequestInterceptor),
-    _batchStream(instance.get(), Ice::currentProtocolEncoding),
-    _batchStreamInUse(false),
-    _batchStreamCanFlush(false),
-    _batchCompress(false),
-    _batchRequestNum(0)
+    //
+    // The interceptor is given the size and number of requests of the batch, it requires a
+    // single batch shared by all the threads.
+    //
+    _perThread(instance->batchPerThread() && !_interceptor),
+    _batchRequestNum(0),
+    _batchSize(0),
+    _instance(instance),
+    _flushDelay(max(flushDelay, 0))
 {
-    _batchStream.writeBlob(requestBatchHdr, sizeof(requestBatchHdr));
-    _batchMarker = _batchStream.b.size();
+    if(!_perThread)
+    {
+        _batches.emplace(thread::id(), make_unique<Batch>(instance.get()));
+    }
 
-    _maxSize = instance->batchAutoFlushSize();
+    _maxSize = maxSize;
     if(_maxSize > 0 && datagram)
     {
         const Ice::InitializationData& initData = instance->initializationData();
@@ -91,10 +133,11 @@ BatchRequestQueue::prepareBatchRequest(OutputStream* os)
     {
         rethrow_exception(_exception);
     }
-    _conditionVariable.wait(lock, [this] { return !_batchStreamInUse; });
+    Batch& batch = getBatch();
+    _conditionVariable.wait(lock, [&batch] { return !batch.inUse; });
 
-    _batchStreamInUse = true;
-    _batchStream.swap(*os);
+    batch.inUse = true;
+    batch.stream.swap(*os);
 }
 
 void
@@ -102,51 +145,67 @@ BatchRequestQueue::finishBatchRequest(OutputStream* os,
                                       const Ice::ObjectPrx& proxy,
                                       const std::string& operation)
 {
+    Batch* batch;
+    bool flush;
+    {
+        lock_guard lock(_mutex);
+        batch = &getBatch();
+        assert(batch->inUse);
+        batch->stream.swap(*os);
+        batch->canFlush = true; // Allow flush to proceed even if the stream is marked in use.
+
+        assert(batch->marker < batch->stream.b.size());
+        flush = _maxSize > 0 &&
+            sizeof(requestBatchHdr) + _batchSize + batch->stream.b.size() - batch->marker >= _maxSize;
+    }
+
     //
-    // No need for synchronization, no other threads are supposed
-    // to modify the queue since we set _batchStreamInUse to true.
+    // No need for synchronization to access the batch stream, no other threads are supposed
+    // to modify the batch since it's in use. The flush of the batch only removes the requests
+    // before the marker.
     //
-    assert(_batchStreamInUse);
-    _batchStream.swap(*os);
-
     try
     {
-        _batchStreamCanFlush = true; // Allow flush to proceed even if the stream is marked in use.
-
-        if(_maxSize > 0 && _batchStream.b.size() >= _maxSize)
+        if(flush)
         {
             proxy->ice_flushBatchRequestsAsync();
         }
 
-        assert(_batchMarker < _batchStream.b.size());
+        assert(batch->marker < batch->stream.b.size());
         if(_interceptor)
         {
-            BatchRequestI request(*this, proxy, operation, static_cast<int>(_batchStream.b.size() - _batchMarker));
-            _interceptor(request, _batchRequestNum, static_cast<int>(_batchMarker));
+            BatchRequestI request(*this, proxy, operation, static_cast<int>(batch->stream.b.size() - batch->marker));
+            _interceptor(request, batch->requestNum, static_cast<int>(batch->marker));
         }
         else
         {
-            bool compress;
-            if(proxy->_getReference()->getCompressOverride(compress))
-            {
-                _batchCompress |= compress;
-            }
-            _batchMarker = _batchStream.b.size();
+            bool compress = false;
+            proxy->_getReference()->getCompressOverride(compress);
+
+            lock_guard lock(_mutex);
+            batch->compress |= compress;
+            _batchSize += batch->stream.b.size() - batch->marker;
+            batch->marker = batch->stream.b.size();
+            ++batch->requestNum;
             ++_batchRequestNum;
         }
 
         lock_guard lock(_mutex);
-        _batchStream.resize(_batchMarker);
-        _batchStreamInUse = false;
-        _batchStreamCanFlush = false;
+        batch->stream.resize(batch->marker);
+        batch->inUse = false;
+        batch->canFlush = false;
         _conditionVariable.notify_all();
+        if(_flushDelay > chrono::milliseconds::zero() && _batchRequestNum > 0 && _flushTask.expired())
+        {
+            scheduleFlush(proxy);
+        }
     }
     catch(const std::exception&)
     {
         lock_guard lock(_mutex);
-        _batchStream.resize(_batchMarker);
-        _batchStreamInUse = false;
-        _batchStreamCanFlush = false;
+        batch->stream.resize(batch->marker);
+        batch->inUse = false;
+        batch->canFlush = false;
         _conditionVariable.notify_all();
         throw;
     }
@@ -156,11 +215,12 @@ void
 BatchRequestQueue::abortBatchRequest(OutputStream* os)
 {
     lock_guard lock(_mutex);
-    if(_batchStreamInUse)
+    Batch& batch = getBatch();
+    if(batch.inUse)
     {
-        _batchStream.swap(*os);
-        _batchStream.resize(_batchMarker);
-        _batchStreamInUse = false;
+        batch.stream.swap(*os);
+        batch.stream.resize(batch.marker);
+        batch.inUse = false;
         _conditionVariable.notify_all();
     }
 }
@@ -174,29 +234,85 @@ BatchRequestQueue::swap(OutputStream* os, bool& compress)
         return 0;
     }
 
-    _conditionVariable.wait(lock, [this] { return !_batchStreamInUse || _batchStreamCanFlush; });
-
-    vector<Ice::Byte> lastRequest;
-    if(_batchMarker < _batchStream.b.size())
+    _conditionVariable.wait(lock, [this] { return canSwap(); });
+    if(_batchRequestNum == 0)
     {
-        vector<Ice::Byte>(_batchStream.b.begin() + _batchMarker, _batchStream.b.end()).swap(lastRequest);
-        _batchStream.b.resize(_batchMarker);
+        return 0; // Flushed by another thread.
     }
 
+    //
+    // Merge the requests of each batch in the output stream. The stream of the first batch
+    // is swapped, the requests of the other batches are appended to it.
+    //
     int requestNum = _batchRequestNum;
-    _batchStream.swap(*os);
-    compress = _batchCompress;
+    compress = false;
+    bool first = true;
+    for(auto p = _batches.begin(); p != _batches.end();)
+    {
+        Batch& batch = *p->second;
+        if(batch.requestNum == 0)
+        {
+            if(_perThread && !batch.inUse)
+            {
+                p = _batches.erase(p); // Release the batch of threads which no longer queue requests.
+            }
+            else
+            {
+                ++p;
+            }
+            continue;
+        }
+
+        vector<Ice::Byte> lastRequest;
+        if(batch.marker < batch.stream.b.size())
+        {
+            vector<Ice::Byte>(batch.stream.b.begin() + batch.marker, batch.stream.b.end()).swap(lastRequest);
+            batch.stream.b.resize(batch.marker);
+        }
+
+        if(first)
+        {
+            batch.stream.swap(*os);
+            batch.stream.writeBlob(requestBatchHdr, sizeof(requestBatchHdr));
+            first = false;
+        }
+        else
+        {
+            os->writeBlob(batch.stream.b.begin() + sizeof(requestBatchHdr), batch.marker - sizeof(requestBatchHdr));
+            batch.stream.b.resize(sizeof(requestBatchHdr));
+        }
+        compress |= batch.compress;
+
+        //
+        // Reset the batch.
+        //
+        batch.requestNum = 0;
+        batch.compress = false;
+        batch.marker = batch.stream.b.size();
+        if(!lastRequest.empty())
+        {
+            batch.stream.writeBlob(&lastRequest[0], lastRequest.size());
+        }
+        ++p;
+    }
+    _batchRequestNum = 0;
+    _batchSize = 0;
 
     //
-    // Reset the batch.
+    // The batch is flushed, cancel the pending auto-flush. It's rescheduled when a request
+    // is added to the new batch.
     //
-    _batchRequestNum = 0;
-    _batchCompress = false;
-    _batchStream.writeBlob(requestBatchHdr, sizeof(requestBatchHdr));
-    _batchMarker = _batchStream.b.size();
-    if(!lastRequest.empty())
+    IceUtil::TimerTaskPtr flushTask = _flushTask.lock();
+    if(flushTask)
     {
-        _batchStream.writeBlob(&lastRequest[0], lastRequest.size());
+        try
+        {
+            _instance->timer()->cancel(flushTask);
+        }
+        catch(const Ice::CommunicatorDestroyedException&)
+        {
+        }
+        _flushTask.reset();
     }
     return requestNum;
 }
@@ -212,18 +328,90 @@ bool
 BatchRequestQueue::isEmpty()
 {
     lock_guard lock(_mutex);
-    return _batchStream.b.size() == sizeof(requestBatchHdr);
+    if(_batchRequestNum > 0)
+    {
+        return false;
+    }
+    for(const auto& p : _batches)
+    {
+        if(p.second->inUse)
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
 void
 BatchRequestQueue::enqueueBatchRequest(const Ice::ObjectPrx& proxy)
 {
-    assert(_batchMarker < _batchStream.b.size());
-    bool compress;
-    if(proxy->_getReference()->getCompressOverride(compress))
+    bool compress = false;
+    proxy->_getReference()->getCompressOverride(compress);
+
+    lock_guard lock(_mutex);
+    Batch& batch = getBatch();
+    assert(batch.marker < batch.stream.b.size());
+    batch.compress |= compress;
+    _batchSize += batch.stream.b.size() - batch.marker;
+    batch.marker = batch.stream.b.size();
+    ++batch.requestNum;
+    ++_batchRequestNum;
+}
+
+BatchRequestQueue::Batch&
+BatchRequestQueue::getBatch()
+{
+    //
+    // Must be called with the mutex locked.
+    //
+    if(!_perThread)
     {
-        _batchCompress |= compress;
+        return *_batches.begin()->second;
+    }
+
+    unique_ptr<Batch>& batch = _batches[this_thread::get_id()];
+    if(!batch)
+    {
+        batch = make_unique<Batch>(_instance.get());
+    }
+    return *batch;
+}
+
+bool
+BatchRequestQueue::canSwap() const
+{
+    //
+    // Must be called with the mutex locked. The batches with queued requests must not be used
+    // by their thread, unless the thread allows the flush while it's finishing a request.
+    //
+    for(const auto& p : _batches)
+    {
+        if(p.second->requestNum > 0 && p.second->inUse && !p.second->canFlush)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+BatchRequestQueue::scheduleFlush(const Ice::ObjectPrx& proxy)
+{
+    //
+    // Must be called with the mutex locked. Flush the batch once the delay elapsed
+    // since its first request, unless it's flushed before.
+    //
+    IceUtil::TimerTaskPtr flushTask = make_shared<BatchFlushTimerTask>(proxy);
+    try
+    {
+        _instance->timer()->schedule(flushTask, _flushDelay);
+        _flushTask = flushTask;
+    }
+    catch(const Ice::CommunicatorDestroyedException&)
+    {
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+        // Expected if the communicator destroyed the timer.
     }
-    _batchMarker = _batchStream.b.size();
-    ++_batchRequestNum;
 }
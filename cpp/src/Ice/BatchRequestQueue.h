@@ -9,9 +9,12 @@
 #include <Ice/BatchRequestQueueF.h>
 #include <Ice/InstanceF.h>
 #include <Ice/OutputStream.h>
+#include <IceUtil/Timer.h>
 
 #include <mutex>
 #include <condition_variable>
+#include <thread>
+#include <unordered_map>
 
 namespace IceInternal
 {
@@ -20,7 +23,7 @@ class BatchRequestQueue
 {
 public:
 
-    BatchRequestQueue(const InstancePtr&, bool);
+    BatchRequestQueue(const InstancePtr&, bool, size_t, int);
 
     void prepareBatchRequest(Ice::OutputStream*);
     void finishBatchRequest(Ice::OutputStream*, const Ice::ObjectPrx&, const std::string&);
@@ -35,16 +38,37 @@ public:
 
 private:
 
+    //
+    // The batch requests queued by a thread, or by all the threads if the queue isn't per-thread.
+    //
+    struct Batch
+    {
+        Batch(Instance*);
+
+        Ice::OutputStream stream;
+        bool inUse;
+        bool canFlush;
+        bool compress;
+        int requestNum;
+        size_t marker;
+    };
+
+    Batch& getBatch();
+    bool canSwap() const;
+    void scheduleFlush(const Ice::ObjectPrx&);
+
     std::function<void(const Ice::BatchRequest&, int, int)> _interceptor;
-    Ice::OutputStream _batchStream;
-    bool _batchStreamInUse;
-    bool _batchStreamCanFlush;
-    bool _batchCompress;
-    int _batchRequestNum;
-    size_t _batchMarker;
+    const bool _perThread;
+    std::unordered_map<std::thread::id, std::unique_ptr<Batch>> _batches;
+    int _batchRequestNum; // The number of requests queued by all the threads.
+    size_t _batchSize; // The size of the requests queued by all the threads, without the batch headers.
     std::exception_ptr _exception;
     size_t _maxSize;
 
+    const InstancePtr _instance;
+    const std::chrono::milliseconds _flushDelay;
+    std::weak_ptr<IceUtil::TimerTask> _flushTask; // The timer owns the task, which holds the proxy to flush.
+
     std::mutex _mutex;
     std::condition_variable _conditionVariable;
 };
@@ -3,6 +3,7 @@
 //
 
 #include <Ice/Buffer.h>
+#include <Ice/BufferPool.h>
 #include <Ice/LocalException.h>
 
 using namespace std;
@@ -21,7 +22,8 @@ IceInternal::Buffer::Container::Container() :
     _size(0),
     _capacity(0),
     _shrinkCounter(0),
-    _owned(true)
+    _owned(true),
+    _pool(0)
 {
 }
 
@@ -30,12 +32,14 @@ IceInternal::Buffer::Container::Container(const_iterator beg, const_iterator end
     _size(static_cast<size_t>(end - beg)),
     _capacity(static_cast<size_t>(end - beg)),
     _shrinkCounter(0),
-    _owned(false)
+    _owned(false),
+    _pool(0)
 {
 }
 
 IceInternal::Buffer::Container::Container(const vector<value_type>& v) :
-    _shrinkCounter(0)
+    _shrinkCounter(0),
+    _pool(0)
 {
     if(v.empty())
     {
@@ -62,6 +66,7 @@ IceInternal::Buffer::Container::Container(Container& other, bool adopt)
         _capacity = other._capacity;
         _shrinkCounter = other._shrinkCounter;
         _owned = other._owned;
+        _pool = other._pool;
 
         other._buf = 0;
         other._size = 0;
@@ -76,6 +81,7 @@ IceInternal::Buffer::Container::Container(Container& other, bool adopt)
         _capacity = other._capacity;
         _shrinkCounter = 0;
         _owned = false;
+        _pool = 0;
     }
 }
 
@@ -83,7 +89,14 @@ IceInternal::Buffer::Container::~Container()
 {
     if(_buf && _owned)
     {
-        ::free(_buf);
+        if(_pool)
+        {
+            _pool->release(_buf, _capacity);
+        }
+        else
+        {
+            ::free(_buf);
+        }
     }
 }
 
@@ -95,6 +108,7 @@ IceInternal::Buffer::Container::swap(Container& other)
     std::swap(_capacity, other._capacity);
     std::swap(_shrinkCounter, other._shrinkCounter);
     std::swap(_owned, other._owned);
+    std::swap(_pool, other._pool);
 }
 
 void
@@ -102,7 +116,14 @@ IceInternal::Buffer::Container::clear()
 {
     if(_buf && _owned)
     {
-        ::free(_buf);
+        if(_pool)
+        {
+            _pool->release(_buf, _capacity);
+        }
+        else
+        {
+            ::free(_buf);
+        }
     }
 
     _buf = 0;
@@ -130,14 +151,22 @@ IceInternal::Buffer::Container::reserve(size_type n)
         return;
     }
 
+    //
+    // The pool rounds up the capacity to its size class, the buffer is left
+    // as is if the new capacity is in the same size class.
+    //
     pointer p;
-    if(_owned)
+    if(_pool && _owned)
+    {
+        p = _buf ? _pool->reallocate(_buf, _size, c, _capacity) : _pool->allocate(_capacity);
+    }
+    else if(_owned)
     {
         p = reinterpret_cast<pointer>(::realloc(_buf, _capacity));
     }
     else
     {
-        p = reinterpret_cast<pointer>(::malloc(_capacity));
+        p = _pool ? _pool->allocate(_capacity) : reinterpret_cast<pointer>(::malloc(_capacity));
         if(p)
         {
             ::memcpy(p, _buf, _size);
@@ -0,0 +1,383 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/BufferPool.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+const size_t minBufferSize = 256;
+const int maxClasses = 16; // From 256 bytes to 8MB.
+
+inline size_t
+classSize(int k)
+{
+    return minBufferSize << k;
+}
+
+//
+// Returns the smallest size class which can hold the given number of bytes,
+// or maxClasses if the buffer is too large for all the size classes.
+//
+inline int
+sizeClass(size_t n)
+{
+    int k = 0;
+    while(k < maxClasses && classSize(k) < n)
+    {
+        ++k;
+    }
+    return k;
+}
+
+//
+// The registry and its mutex are never deleted, buffers might be released
+// by threads that exit after the static destructors ran.
+//
+mutex&
+registryMutex()
+{
+    static mutex* m = new mutex;
+    return *m;
+}
+
+vector<BufferPool*>&
+registry()
+{
+    static vector<BufferPool*>* pools = new vector<BufferPool*>;
+    return *pools;
+}
+
+}
+
+struct IceInternal::BufferPool::ThreadCacheEntry
+{
+    ThreadCacheEntry() : generation(0), hits(0), misses(0)
+    {
+    }
+
+    void clear()
+    {
+        for(int k = 0; k < maxClasses; ++k)
+        {
+            for(Byte* p : buffers[k])
+            {
+                ::free(p);
+            }
+            buffers[k].clear();
+        }
+        hits = 0;
+        misses = 0;
+    }
+
+    unsigned int generation;
+    int hits;
+    int misses;
+    vector<Byte*> buffers[maxClasses];
+};
+
+struct IceInternal::BufferPool::ThreadCache
+{
+    ~ThreadCache();
+
+    vector<ThreadCacheEntry> entries; // Indexed by the pool registry index.
+};
+
+namespace
+{
+
+thread_local BufferPool::ThreadCache threadCache;
+thread_local bool threadCacheDestroyed = false;
+
+}
+
+IceInternal::BufferPool::ThreadCache::~ThreadCache()
+{
+    threadCacheDestroyed = true;
+    for(size_t i = 0; i < entries.size(); ++i)
+    {
+        BufferPool* pool;
+        {
+            lock_guard lock(registryMutex());
+            pool = registry()[i];
+        }
+        pool->releaseThreadCache(entries[i]);
+    }
+}
+
+BufferPool*
+IceInternal::BufferPool::create(size_t maxBufferSize, size_t threadCacheSize)
+{
+    lock_guard lock(registryMutex());
+    vector<BufferPool*>& pools = registry();
+    auto p = find_if(pools.begin(), pools.end(), [](BufferPool* pool) { return !pool->_inUse; });
+    BufferPool* pool;
+    if(p != pools.end())
+    {
+        pool = *p;
+    }
+    else
+    {
+        pool = new BufferPool(pools.size());
+        pools.push_back(pool);
+    }
+    pool->_inUse = true;
+
+    //
+    // Bumping the generation discards the thread cache entries left over by
+    // the previous user of the pool the next time a thread uses the pool.
+    //
+    pool->_threadCacheSize = threadCacheSize;
+    pool->_generation.fetch_add(1);
+    pool->_numClasses = sizeClass(maxBufferSize + 1);
+    return pool;
+}
+
+void
+IceInternal::BufferPool::destroy()
+{
+    {
+        lock_guard lock(_mutex);
+        _numClasses = 0;
+        for(auto& buffers : _buffers)
+        {
+            for(Byte* p : buffers)
+            {
+                ::free(p);
+            }
+            buffers.clear();
+        }
+    }
+    _generation.fetch_add(1);
+
+    lock_guard lock(registryMutex());
+    _inUse = false;
+}
+
+Byte*
+IceInternal::BufferPool::allocate(size_t& capacity)
+{
+    int k = sizeClass(capacity);
+    if(k < _numClasses.load(memory_order_relaxed))
+    {
+        capacity = classSize(k);
+        ThreadCacheEntry* entry = threadCacheEntry();
+        if(entry && !entry->buffers[k].empty())
+        {
+            Byte* p = entry->buffers[k].back();
+            entry->buffers[k].pop_back();
+            ++entry->hits;
+            return p;
+        }
+
+        Byte* p = allocateCentral(k, entry);
+        if(entry)
+        {
+            ++(p ? entry->hits : entry->misses);
+        }
+        if(p)
+        {
+            return p;
+        }
+    }
+    return reinterpret_cast<Byte*>(::malloc(capacity));
+}
+
+Byte*
+IceInternal::BufferPool::reallocate(Byte* p, size_t size, size_t oldCapacity, size_t& capacity)
+{
+    int k = sizeClass(capacity);
+    if(k < _numClasses.load(memory_order_relaxed))
+    {
+        if(classSize(k) == oldCapacity)
+        {
+            capacity = oldCapacity; // Same size class, nothing to do.
+            return p;
+        }
+
+        Byte* q = allocate(capacity);
+        if(q)
+        {
+            ::memcpy(q, p, size);
+            release(p, oldCapacity);
+        }
+        return q;
+    }
+
+    //
+    // Too large for the pool. The buffer is always allocated with malloc so
+    // it can be reallocated even if it comes from the pool.
+    //
+    return reinterpret_cast<Byte*>(::realloc(p, capacity));
+}
+
+void
+IceInternal::BufferPool::release(Byte* p, size_t capacity)
+{
+    int k = sizeClass(capacity);
+    if(k < _numClasses.load(memory_order_relaxed) && classSize(k) == capacity)
+    {
+        ThreadCacheEntry* entry = threadCacheEntry();
+        if(entry && entry->buffers[k].size() < threadCacheLimit(k))
+        {
+            entry->buffers[k].push_back(p);
+        }
+        else
+        {
+            releaseCentral(k, p, entry);
+        }
+        return;
+    }
+    ::free(p);
+}
+
+void
+IceInternal::BufferPool::takeStats(int& hits, int& misses)
+{
+    ThreadCacheEntry* entry = threadCacheEntry();
+    if(entry)
+    {
+        hits = entry->hits;
+        misses = entry->misses;
+        entry->hits = 0;
+        entry->misses = 0;
+    }
+    else
+    {
+        hits = 0;
+        misses = 0;
+    }
+}
+
+IceInternal::BufferPool::BufferPool(size_t index) :
+    _index(index),
+    _numClasses(0),
+    _threadCacheSize(0),
+    _generation(0),
+    _inUse(false),
+    _buffers(maxClasses)
+{
+}
+
+BufferPool::ThreadCacheEntry*
+IceInternal::BufferPool::threadCacheEntry()
+{
+    if(threadCacheDestroyed)
+    {
+        return 0; // The thread is exiting.
+    }
+
+    vector<ThreadCacheEntry>& entries = threadCache.entries;
+    if(_index >= entries.size())
+    {
+        entries.resize(_index + 1);
+    }
+
+    ThreadCacheEntry& entry = entries[_index];
+    unsigned int generation = _generation.load(memory_order_relaxed);
+    if(entry.generation != generation)
+    {
+        entry.clear();
+        entry.generation = generation;
+    }
+    return &entry;
+}
+
+size_t
+IceInternal::BufferPool::threadCacheLimit(int k) const
+{
+    return max<size_t>(1, _threadCacheSize.load(memory_order_relaxed) / classSize(k));
+}
+
+Byte*
+IceInternal::BufferPool::allocateCentral(int k, ThreadCacheEntry* entry)
+{
+    //
+    // Take a buffer from the central cache and refill the thread cache with
+    // up to half of its limit, to amortize the locking over several allocations.
+    //
+    lock_guard lock(_mutex);
+    vector<Byte*>& buffers = _buffers[k];
+    if(buffers.empty())
+    {
+        return 0;
+    }
+
+    Byte* p = buffers.back();
+    buffers.pop_back();
+    if(entry)
+    {
+        size_t n = min(buffers.size(), threadCacheLimit(k) / 2);
+        entry->buffers[k].insert(entry->buffers[k].end(), buffers.end() - static_cast<ptrdiff_t>(n), buffers.end());
+        buffers.resize(buffers.size() - n);
+    }
+    return p;
+}
+
+void
+IceInternal::BufferPool::releaseCentral(int k, Byte* p, ThreadCacheEntry* entry)
+{
+    //
+    // The thread cache is full: move the buffer and half of the thread cache
+    // to the central cache. The central cache holds up to 8 times the thread
+    // cache limit, the buffers that don't fit are freed.
+    //
+    lock_guard lock(_mutex);
+    vector<Byte*>& buffers = _buffers[k];
+    const bool pooled = k < _numClasses.load(memory_order_relaxed);
+    const size_t limit = 8 * threadCacheLimit(k);
+    auto put = [&](Byte* b)
+    {
+        if(pooled && buffers.size() < limit)
+        {
+            buffers.push_back(b);
+        }
+        else
+        {
+            ::free(b);
+        }
+    };
+
+    put(p);
+    if(entry)
+    {
+        vector<Byte*>& threadBuffers = entry->buffers[k];
+        for(size_t n = threadBuffers.size() / 2; n > 0; --n)
+        {
+            put(threadBuffers.back());
+            threadBuffers.pop_back();
+        }
+    }
+}
+
+void
+IceInternal::BufferPool::releaseThreadCache(ThreadCacheEntry& entry)
+{
+    //
+    // Called when a thread exits, the buffers of the thread cache are moved
+    // to the central cache.
+    //
+    if(entry.generation == _generation.load(memory_order_relaxed))
+    {
+        for(int k = 0; k < maxClasses; ++k)
+        {
+            vector<Byte*>& threadBuffers = entry.buffers[k];
+            while(!threadBuffers.empty())
+            {
+                Byte* p = threadBuffers.back();
+                threadBuffers.pop_back();
+                releaseCentral(k, p, 0);
+            }
+        }
+    }
+    entry.clear();
+}
@@ -0,0 +1,86 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_BUFFER_POOL_H
+#define ICE_BUFFER_POOL_H
+
+#include <Ice/Config.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// A pool of size-classed buffers for the stream buffers of a communicator.
+// The capacity of pooled buffers is rounded up to a power of two size class,
+// from 256 bytes up to the pool maximum buffer size. Released buffers are
+// cached by the releasing thread and, once the thread cache of the size class
+// is full, in a central cache shared by all the threads. Larger buffers are
+// allocated and freed with malloc and free.
+//
+// Pooled buffers are allocated with malloc so a buffer can always be freed
+// or reallocated by a container that doesn't use the pool.
+//
+// Pools are never deleted: destroy() returns the pool to a process-wide
+// registry for re-use by another communicator. This way, a buffer which
+// outlives its communicator can still be safely released to its pool.
+//
+class BufferPool : private IceUtil::noncopyable
+{
+public:
+
+    static BufferPool* create(size_t, size_t);
+    void destroy();
+
+    //
+    // Allocate a buffer of at least the given capacity, the capacity is
+    // updated with the capacity of the returned buffer. Returns 0 if the
+    // allocation fails.
+    //
+    Ice::Byte* allocate(size_t&);
+
+    //
+    // Reallocate the buffer to at least the given capacity and copy the
+    // given number of bytes. The buffer isn't released if the reallocation
+    // fails.
+    //
+    Ice::Byte* reallocate(Ice::Byte*, size_t, size_t, size_t&);
+
+    void release(Ice::Byte*, size_t);
+
+    //
+    // Get and reset the number of allocations of the calling thread that
+    // were served from the pool (hits) and from the heap (misses).
+    //
+    void takeStats(int&, int&);
+
+    struct ThreadCacheEntry;
+    struct ThreadCache;
+
+private:
+
+    explicit BufferPool(size_t);
+
+    ThreadCacheEntry* threadCacheEntry();
+    size_t threadCacheLimit(int) const;
+    Ice::Byte* allocateCentral(int, ThreadCacheEntry*);
+    void releaseCentral(int, Ice::Byte*, ThreadCacheEntry*);
+    void releaseThreadCache(ThreadCacheEntry&);
+
+    const size_t _index;
+    std::atomic<int> _numClasses;
+    std::atomic<size_t> _threadCacheSize;
+    std::atomic<unsigned int> _generation;
+    bool _inUse; // Protected by the registry mutex.
+
+    std::mutex _mutex;
+    std::vector<std::vector<Ice::Byte*>> _buffers;
+};
+
+}
+
+#endif
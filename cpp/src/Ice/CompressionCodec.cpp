@@ -0,0 +1,337 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/CompressionCodec.h>
+#include <Ice/LocalException.h>
+#include <Ice/Properties.h>
+
+#ifndef ICE_HAS_BZIP2
+#   define ICE_HAS_BZIP2
+#endif
+
+#ifdef ICE_HAS_BZIP2
+#  include <bzlib.h>
+#endif
+#ifdef ICE_HAS_LZ4
+#  include <lz4.h>
+#endif
+#ifdef ICE_HAS_ZSTD
+#  include <zstd.h>
+#endif
+
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+#ifdef ICE_HAS_BZIP2
+string
+getBZ2Error(int bzError)
+{
+    if(bzError == BZ_RUN_OK)
+    {
+        return ": BZ_RUN_OK";
+    }
+    else if(bzError == BZ_FLUSH_OK)
+    {
+        return ": BZ_FLUSH_OK";
+    }
+    else if(bzError == BZ_FINISH_OK)
+    {
+        return ": BZ_FINISH_OK";
+    }
+    else if(bzError == BZ_STREAM_END)
+    {
+        return ": BZ_STREAM_END";
+    }
+    else if(bzError == BZ_CONFIG_ERROR)
+    {
+        return ": BZ_CONFIG_ERROR";
+    }
+    else if(bzError == BZ_SEQUENCE_ERROR)
+    {
+        return ": BZ_SEQUENCE_ERROR";
+    }
+    else if(bzError == BZ_PARAM_ERROR)
+    {
+        return ": BZ_PARAM_ERROR";
+    }
+    else if(bzError == BZ_MEM_ERROR)
+    {
+        return ": BZ_MEM_ERROR";
+    }
+    else if(bzError == BZ_DATA_ERROR)
+    {
+        return ": BZ_DATA_ERROR";
+    }
+    else if(bzError == BZ_DATA_ERROR_MAGIC)
+    {
+        return ": BZ_DATA_ERROR_MAGIC";
+    }
+    else if(bzError == BZ_IO_ERROR)
+    {
+        return ": BZ_IO_ERROR";
+    }
+    else if(bzError == BZ_UNEXPECTED_EOF)
+    {
+        return ": BZ_UNEXPECTED_EOF";
+    }
+    else if(bzError == BZ_OUTBUFF_FULL)
+    {
+        return ": BZ_OUTBUFF_FULL";
+    }
+    else
+    {
+        return "";
+    }
+}
+
+class BZip2Codec final : public CompressionCodec
+{
+public:
+
+    Byte id() const final
+    {
+        return bzip2CompressionCodec;
+    }
+
+    string name() const final
+    {
+        return "bzip2";
+    }
+
+    size_t compressBound(size_t size) const final
+    {
+        return static_cast<size_t>(static_cast<double>(size) * 1.01 + 600);
+    }
+
+    size_t compress(const Byte* in, size_t inSize, Byte* out, size_t outSize, int level) const final
+    {
+        unsigned int compressedLen = static_cast<unsigned int>(outSize);
+        int bzError = BZ2_bzBuffToBuffCompress(reinterpret_cast<char*>(out), &compressedLen,
+                                               const_cast<char*>(reinterpret_cast<const char*>(in)),
+                                               static_cast<unsigned int>(inSize), level, 0, 0);
+        if(bzError != BZ_OK)
+        {
+            throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
+        }
+        return compressedLen;
+    }
+
+    void uncompress(const Byte* in, size_t inSize, Byte* out, size_t outSize) const final
+    {
+        unsigned int uncompressedLen = static_cast<unsigned int>(outSize);
+        int bzError = BZ2_bzBuffToBuffDecompress(reinterpret_cast<char*>(out), &uncompressedLen,
+                                                 const_cast<char*>(reinterpret_cast<const char*>(in)),
+                                                 static_cast<unsigned int>(inSize), 0, 0);
+        if(bzError != BZ_OK)
+        {
+            throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffDecompress failed" + getBZ2Error(bzError));
+        }
+    }
+};
+#endif
+
+#ifdef ICE_HAS_LZ4
+class LZ4Codec final : public CompressionCodec
+{
+public:
+
+    Byte id() const final
+    {
+        return lz4CompressionCodec;
+    }
+
+    string name() const final
+    {
+        return "lz4";
+    }
+
+    size_t compressBound(size_t size) const final
+    {
+        return static_cast<size_t>(LZ4_compressBound(static_cast<int>(size)));
+    }
+
+    size_t compress(const Byte* in, size_t inSize, Byte* out, size_t outSize, int) const final
+    {
+        //
+        // The compression level is ignored, LZ4 is used for its speed.
+        //
+        int size = LZ4_compress_default(reinterpret_cast<const char*>(in), reinterpret_cast<char*>(out),
+                                        static_cast<int>(inSize), static_cast<int>(outSize));
+        if(size <= 0)
+        {
+            throw CompressionException(__FILE__, __LINE__, "LZ4_compress_default failed");
+        }
+        return static_cast<size_t>(size);
+    }
+
+    void uncompress(const Byte* in, size_t inSize, Byte* out, size_t outSize) const final
+    {
+        int size = LZ4_decompress_safe(reinterpret_cast<const char*>(in), reinterpret_cast<char*>(out),
+                                       static_cast<int>(inSize), static_cast<int>(outSize));
+        if(size < 0 || static_cast<size_t>(size) != outSize)
+        {
+            throw CompressionException(__FILE__, __LINE__, "LZ4_decompress_safe failed");
+        }
+    }
+};
+#endif
+
+#ifdef ICE_HAS_ZSTD
+class ZstdCodec final : public CompressionCodec
+{
+public:
+
+    Byte id() const final
+    {
+        return zstdCompressionCodec;
+    }
+
+    string name() const final
+    {
+        return "zstd";
+    }
+
+    size_t compressBound(size_t size) const final
+    {
+        return ZSTD_compressBound(size);
+    }
+
+    size_t compress(const Byte* in, size_t inSize, Byte* out, size_t outSize, int level) const final
+    {
+        size_t size = ZSTD_compress(out, outSize, in, inSize, level);
+        if(ZSTD_isError(size))
+        {
+            throw CompressionException(__FILE__, __LINE__, string("ZSTD_compress failed: ") + ZSTD_getErrorName(size));
+        }
+        return size;
+    }
+
+    void uncompress(const Byte* in, size_t inSize, Byte* out, size_t outSize) const final
+    {
+        size_t size = ZSTD_decompress(out, outSize, in, inSize);
+        if(ZSTD_isError(size))
+        {
+            throw CompressionException(__FILE__, __LINE__, string("ZSTD_decompress failed: ") +
+                                       ZSTD_getErrorName(size));
+        }
+        else if(size != outSize)
+        {
+            throw CompressionException(__FILE__, __LINE__, "ZSTD_decompress failed: unexpected uncompressed size");
+        }
+    }
+};
+#endif
+
+}
+
+IceInternal::CompressionCodec::~CompressionCodec()
+{
+    // Out of line to avoid weak vtable
+}
+
+IceInternal::CompressionCodecManager::CompressionCodecManager(const PropertiesPtr& properties) :
+    _preferred(properties->getPropertyAsListWithDefault("Ice.Compression.Codecs", { "zstd", "lz4", "bzip2" }))
+{
+#ifdef ICE_HAS_BZIP2
+    _codecs.push_back(make_shared<BZip2Codec>());
+#endif
+#ifdef ICE_HAS_LZ4
+    _codecs.push_back(make_shared<LZ4Codec>());
+#endif
+#ifdef ICE_HAS_ZSTD
+    _codecs.push_back(make_shared<ZstdCodec>());
+#endif
+}
+
+void
+IceInternal::CompressionCodecManager::add(const CompressionCodecPtr& codec)
+{
+    lock_guard lock(_mutex);
+
+    if(codec->id() <= bzip2CompressionCodec || codec->id() > maxCompressionCodec)
+    {
+        throw InitializationException(__FILE__, __LINE__, "invalid identifier for compression codec `" +
+                                      codec->name() + "'");
+    }
+
+    for(const auto& p : _codecs)
+    {
+        if(p->id() == codec->id() || p->name() == codec->name())
+        {
+            throw AlreadyRegisteredException(__FILE__, __LINE__, "compression codec", codec->name());
+        }
+    }
+    _codecs.push_back(codec);
+}
+
+CompressionCodecPtr
+IceInternal::CompressionCodecManager::get(Byte id) const
+{
+    lock_guard lock(_mutex);
+    for(const auto& p : _codecs)
+    {
+        if(p->id() == id)
+        {
+            return p;
+        }
+    }
+    return nullptr;
+}
+
+Byte
+IceInternal::CompressionCodecManager::supported() const
+{
+    lock_guard lock(_mutex);
+    Byte supported = 0;
+    for(const auto& p : _codecs)
+    {
+        if(p->id() > bzip2CompressionCodec && find(_preferred.begin(), _preferred.end(), p->name()) != _preferred.end())
+        {
+            supported = static_cast<Byte>(supported | (1 << (p->id() - lz4CompressionCodec)));
+        }
+    }
+    return supported;
+}
+
+CompressionCodecPtr
+IceInternal::CompressionCodecManager::select(Byte supported) const
+{
+    lock_guard lock(_mutex);
+    CompressionCodecPtr bzip2;
+    for(const auto& p : _codecs)
+    {
+        if(p->id() == bzip2CompressionCodec)
+        {
+            bzip2 = p;
+            break;
+        }
+    }
+
+    for(const auto& name : _preferred)
+    {
+        for(const auto& p : _codecs)
+        {
+            if(p->name() == name)
+            {
+                if(p->id() == bzip2CompressionCodec)
+                {
+                    return p;
+                }
+                else if(supported & (1 << (p->id() - lz4CompressionCodec)))
+                {
+                    return p;
+                }
+                break;
+            }
+        }
+    }
+    return bzip2;
+}
@@ -0,0 +1,106 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_COMPRESSION_CODEC_H
+#define ICE_COMPRESSION_CODEC_H
+
+#include <Ice/Config.h>
+#include <Ice/CompressionCodecF.h>
+#include <Ice/PropertiesF.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The compression status of a compressed message is the identifier of
+// the codec used to compress it. Identifier 2 is bzip2, the only codec
+// known by peers that don't negotiate a codec.
+//
+const Ice::Byte bzip2CompressionCodec = 2;
+const Ice::Byte lz4CompressionCodec = 3;
+const Ice::Byte zstdCompressionCodec = 4;
+
+//
+// The server advertises the codecs it supports besides bzip2 with the
+// compression status of the validate connection message. Bit (id - 3)
+// is set for each supported codec so identifiers are limited to 10.
+//
+const Ice::Byte maxCompressionCodec = 10;
+
+//
+// A compression codec compresses and uncompresses message bodies.
+//
+class ICE_API CompressionCodec
+{
+public:
+
+    virtual ~CompressionCodec();
+
+    //
+    // The codec identifier, sent as the compression status of messages
+    // compressed with this codec.
+    //
+    virtual Ice::Byte id() const = 0;
+
+    //
+    // The codec name, used by the Ice.Compression.Codecs property.
+    //
+    virtual std::string name() const = 0;
+
+    //
+    // The size of the buffer required to compress the given number of
+    // bytes.
+    //
+    virtual size_t compressBound(size_t) const = 0;
+
+    //
+    // Compress the input buffer into the output buffer with the given
+    // compression level (1-9) and return the compressed size. Raises
+    // CompressionException on failure.
+    //
+    virtual size_t compress(const Ice::Byte*, size_t, Ice::Byte*, size_t, int) const = 0;
+
+    //
+    // Uncompress the input buffer into the output buffer, which must
+    // have the exact uncompressed size. Raises CompressionException on
+    // failure.
+    //
+    virtual void uncompress(const Ice::Byte*, size_t, Ice::Byte*, size_t) const = 0;
+};
+
+class CompressionCodecManager
+{
+public:
+
+    CompressionCodecManager(const Ice::PropertiesPtr&);
+
+    void add(const CompressionCodecPtr&);
+    CompressionCodecPtr get(Ice::Byte) const;
+
+    //
+    // The codecs from Ice.Compression.Codecs supported besides bzip2, as
+    // advertised by the server with the validate connection message.
+    //
+    Ice::Byte supported() const;
+
+    //
+    // Select the first codec from Ice.Compression.Codecs supported by
+    // the server, or bzip2 if none is.
+    //
+    CompressionCodecPtr select(Ice::Byte) const;
+
+private:
+
+    const std::vector<std::string> _preferred;
+    std::vector<CompressionCodecPtr> _codecs;
+    mutable std::mutex _mutex;
+};
+
+}
+
+#endif
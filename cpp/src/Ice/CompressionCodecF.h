@@ -0,0 +1,21 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_COMPRESSION_CODEC_F_H
+#define ICE_COMPRESSION_CODEC_F_H
+
+#include <memory>
+
+namespace IceInternal
+{
+
+class CompressionCodec;
+using CompressionCodecPtr = std::shared_ptr<CompressionCodec>;
+
+class CompressionCodecManager;
+using CompressionCodecManagerPtr = std::shared_ptr<CompressionCodecManager>;
+
+}
+
+#endif
@@ -6,6 +6,7 @@
 #include <Ice/Instance.h>
 #include <Ice/Proxy.h>
 #include <Ice/ConnectionI.h>
+#include <Ice/ConnectionFactory.h>
 #include <Ice/RouterInfo.h>
 #include <Ice/OutgoingAsync.h>
 #include <Ice/Protocol.h>
@@ -18,6 +19,7 @@ using namespace IceInternal;
 
 ConnectRequestHandler::ConnectRequestHandler(const ReferencePtr& ref) :
     RequestHandler(ref),
+    _connectionFactory(ref->getRouterInfo() ? nullptr : ref->getInstance()->outgoingConnectionFactory()),
     _initialized(false),
     _flushing(false)
 {
@@ -39,6 +41,15 @@ ConnectRequestHandler::sendAsyncRequest(const ProxyOutgoingAsyncBasePtr& out)
             return AsyncStatusQueued;
         }
     }
+
+    //
+    // Stripe the requests over the connections of the pool, unless we use a
+    // router which ties the proxy to the connection.
+    //
+    if(_connectionFactory)
+    {
+        return out->invokeRemote(_connectionFactory->getPooledConnection(_connection), _compress, _response);
+    }
     return out->invokeRemote(_connection, _compress, _response);
 }
 
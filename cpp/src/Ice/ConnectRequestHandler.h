@@ -10,6 +10,7 @@
 #include <Ice/Reference.h>
 #include <Ice/RouterInfo.h>
 #include <Ice/ProxyF.h>
+#include <Ice/ConnectionFactoryF.h>
 
 #include <condition_variable>
 #include <deque>
@@ -43,6 +44,7 @@ private:
     bool initialized(std::unique_lock<std::mutex>&);
     void flushRequests();
 
+    const OutgoingConnectionFactoryPtr _connectionFactory;
     Ice::ConnectionIPtr _connection;
     bool _compress;
     std::exception_ptr _exception;
@@ -42,3 +42,11 @@ Ice::UDPConnectionInfo::~UDPConnectionInfo()
 Ice::WSConnectionInfo::~WSConnectionInfo()
 {
 }
+
+Ice::UNIXConnectionInfo::~UNIXConnectionInfo()
+{
+}
+
+Ice::SHMConnectionInfo::~SHMConnectionInfo()
+{
+}
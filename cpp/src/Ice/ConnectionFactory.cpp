@@ -22,6 +22,7 @@
 #include <Ice/CommunicatorI.h>
 #include <IceUtil/Random.h>
 #include <iterator>
+#include <optional>
 
 #if TARGET_OS_IPHONE != 0
 namespace IceInternal
@@ -250,6 +251,71 @@ IceInternal::OutgoingConnectionFactory::createAsync(
     cb->getConnectors();
 }
 
+ConnectionIPtr
+IceInternal::OutgoingConnectionFactory::getPooledConnection(const ConnectionIPtr& connection)
+{
+    if(_connectionPoolSize == 1 || connection->endpoint()->datagram())
+    {
+        return connection;
+    }
+
+    //
+    // Return the connection to the same connector with the fewest outstanding
+    // requests. If all the connections are busy and the pool isn't full, we
+    // establish a new connection in the background for the next requests.
+    //
+    ConnectionIPtr leastBusy;
+    bool grow;
+    {
+        lock_guard lock(_mutex);
+        if(_destroyed)
+        {
+            return connection;
+        }
+
+        int leastOutstanding = 0;
+        int size = 0;
+        auto pr = _connections.equal_range(connection->connector());
+        for(auto p = pr.first; p != pr.second; ++p)
+        {
+            int outstanding = p->second->getOutstandingRequestCount();
+            if(outstanding < 0)
+            {
+                continue;
+            }
+
+            ++size;
+            if(!leastBusy || outstanding < leastOutstanding)
+            {
+                leastBusy = p->second;
+                leastOutstanding = outstanding;
+            }
+        }
+
+        if(!leastBusy)
+        {
+            return connection;
+        }
+
+        grow = leastOutstanding > 0 && size < _connectionPoolSize &&
+            _pending.find(connection->connector()) == _pending.end();
+    }
+
+    if(grow)
+    {
+        auto cb = make_shared<ConnectCallback>(
+            _instance,
+            shared_from_this(),
+            vector<EndpointIPtr>{ connection->endpoint() },
+            false,
+            [](Ice::ConnectionIPtr, bool) {},
+            [](std::exception_ptr) {},
+            Ice::EndpointSelectionType::Ordered);
+        cb->addConnection(ConnectorInfo(connection->connector(), connection->endpoint()));
+    }
+    return leastBusy;
+}
+
 void
 IceInternal::OutgoingConnectionFactory::setRouterInfo(const RouterInfoPtr& routerInfo)
 {
@@ -359,6 +425,10 @@ IceInternal::OutgoingConnectionFactory::OutgoingConnectionFactory(const Communic
     _communicator(communicator),
     _instance(instance),
     _monitor(new FactoryACMMonitor(instance, instance->clientACM())),
+    _connectionPoolSize(max(instance->initializationData().properties->getPropertyAsIntWithDefault(
+        "Ice.ConnectionPoolSize", 1), 1)),
+    _connectionAttemptDelay(max(instance->initializationData().properties->getPropertyAsIntWithDefault(
+        "Ice.ConnectionAttemptDelay", 0), 0)),
     _destroyed(false),
     _pendingConnectCount(0)
 {
@@ -883,7 +953,9 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(
     _hasMore(hasMore),
     _createConnectionResponse(std::move(createConnectionResponse)),
     _createConnectionException(std::move(createConnectionException)),
-    _selType(selType)
+    _selType(selType),
+    _attemptCount(0),
+    _connected(false)
 {
     _endpointsIter = _endpoints.begin();
 }
@@ -894,21 +966,66 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartCompleted(const ConnectionIPtr& connection)
 {
-    if(_observer)
+    bool first;
+    vector<ConnectionIPtr> others;
+    optional<Attempt> attempt;
+    {
+        lock_guard lock(_mutex);
+        auto p = _attempts.find(connection);
+        assert(p != _attempts.end());
+        attempt.emplace(p->second);
+        _attempts.erase(p);
+        --_attemptCount;
+
+        first = !_connected;
+        if(first)
+        {
+            _connected = true;
+            for(const auto& q : _attempts)
+            {
+                others.push_back(q.first);
+            }
+        }
+    }
+
+    if(attempt->observer)
+    {
+        attempt->observer->detach();
+    }
+
+    if(!first)
+    {
+        //
+        // Another attempt already established a connection to the server.
+        //
+        connection->close(ConnectionClose::Gracefully);
+        return;
+    }
+
+    cancelNextConnector();
+    for(const auto& p : others)
     {
-        _observer->detach();
+        p->close(ConnectionClose::Forcefully);
     }
 
     connection->activate();
-    _factory->finishGetConnection(_connectors, *_iter, connection, shared_from_this());
+    _factory->finishGetConnection(_connectors, attempt->connector, connection, shared_from_this());
 }
 
 void
-IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailed(const ConnectionIPtr& /*connection*/,
+IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailed(const ConnectionIPtr& connection,
                                                                                exception_ptr ex)
 {
-    assert(_iter != _connectors.end());
-    if(connectionStartFailedImpl(ex))
+    optional<Attempt> attempt;
+    {
+        lock_guard lock(_mutex);
+        auto p = _attempts.find(connection);
+        assert(p != _attempts.end());
+        attempt.emplace(p->second);
+        _attempts.erase(p);
+    }
+
+    if(connectionStartFailedImpl(attempt->observer, ex))
     {
         nextConnector();
     }
@@ -987,6 +1104,40 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::getConnectors()
     nextEndpoint();
 }
 
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::addConnection(const ConnectorInfo& ci)
+{
+    //
+    // Establish a new connection to a connector which already has connections
+    // to grow the connection pool, unless another connection to this connector
+    // is being established.
+    //
+    try
+    {
+        _factory->incPendingConnectCount();
+    }
+    catch (const std::exception&)
+    {
+        return;
+    }
+
+    _connectors.push_back(ci);
+    _iter = _connectors.begin();
+
+    bool pending;
+    {
+        lock_guard lock(_factory->_mutex);
+        pending = _factory->_destroyed || _factory->addToPending(nullptr, _connectors);
+    }
+
+    if(pending)
+    {
+        _factory->decPendingConnectCount(); // Must be called last.
+        return;
+    }
+    nextConnector();
+}
+
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::nextEndpoint()
 {
@@ -1049,27 +1200,43 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::nextConnector()
 {
     while(true)
     {
+        vector<ConnectorInfo>::const_iterator ci;
+        {
+            lock_guard lock(_mutex);
+            if(_connected || _iter == _connectors.end())
+            {
+                return;
+            }
+            ci = _iter++;
+            ++_attemptCount;
+        }
+
+        ObserverPtr observer;
         try
         {
             const CommunicatorObserverPtr& obsv = _factory->_instance->initializationData().observer;
             if(obsv)
             {
-                _observer = obsv->getConnectionEstablishmentObserver(_iter->endpoint, _iter->connector->toString());
-                if(_observer)
+                observer = obsv->getConnectionEstablishmentObserver(ci->endpoint, ci->connector->toString());
+                if(observer)
                 {
-                    _observer->attach();
+                    observer->attach();
                 }
             }
 
-            assert(_iter != _connectors.end());
-
             if(_instance->traceLevels()->network >= 2)
             {
                 Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
-                out << "trying to establish " << _iter->endpoint->protocol() << " connection to "
-                    << _iter->connector->toString();
+                out << "trying to establish " << ci->endpoint->protocol() << " connection to "
+                    << ci->connector->toString();
+            }
+            Ice::ConnectionIPtr connection = _factory->createConnection(ci->connector->connect(), *ci);
+            {
+                lock_guard lock(_mutex);
+                _attempts.emplace(connection, Attempt(*ci, observer));
             }
-            Ice::ConnectionIPtr connection = _factory->createConnection(_iter->connector->connect(), *_iter);
+            scheduleNextConnector();
+
             auto self = shared_from_this();
             connection->startAsync(
                 [self](ConnectionIPtr conn)
@@ -1086,11 +1253,11 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::nextConnector()
             if(_instance->traceLevels()->network >= 2)
             {
                 Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
-                out << "failed to establish " << _iter->endpoint->protocol() << " connection to "
-                    << _iter->connector->toString() << "\n" << ex;
+                out << "failed to establish " << ci->endpoint->protocol() << " connection to "
+                    << ci->connector->toString() << "\n" << ex;
             }
 
-            if(connectionStartFailedImpl(current_exception()))
+            if(connectionStartFailedImpl(observer, current_exception()))
             {
                 continue; // More connectors to try, continue.
             }
@@ -1149,7 +1316,8 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::removeFromPending()
 }
 
 bool
-IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedImpl(std::exception_ptr ex)
+IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedImpl(const ObserverPtr& observer,
+                                                                                   std::exception_ptr ex)
 {
     bool communicatorDestroyed = false;
     try
@@ -1164,27 +1332,105 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedIm
     {
     }
 
-    if(_observer)
+    bool connected;
+    bool more;
+    bool last;
+    {
+        lock_guard lock(_mutex);
+        --_attemptCount;
+        if(communicatorDestroyed) // No need to continue.
+        {
+            _iter = _connectors.end();
+        }
+        connected = _connected;
+        more = _iter != _connectors.end();
+        last = !connected && !more && _attemptCount == 0;
+    }
+
+    if(observer)
     {
-        _observer->failed(getExceptionId(ex));
-        _observer->detach();
+        if(!connected)
+        {
+            observer->failed(getExceptionId(ex));
+        }
+        observer->detach();
+    }
+
+    if(connected)
+    {
+        //
+        // The attempt was aborted because another attempt established a connection to the server.
+        //
+        return false;
     }
 
-    _factory->handleConnectionException(ex, _hasMore || _iter != _connectors.end() - 1);
+    _factory->handleConnectionException(ex, _hasMore || !last);
 
-    if(communicatorDestroyed) // No need to continue.
+    if(last)
     {
+        cancelNextConnector();
         _factory->finishGetConnection(_connectors, ex, shared_from_this());
+        return false;
     }
-    else if(++_iter != _connectors.end()) // Try the next connector.
+    else if(more)
     {
-        return true;
+        return true; // Try the next connector now instead of waiting for the connection attempt delay.
     }
-    else
+    return false; // Wait for the other attempts in progress.
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::runTimerTask()
+{
+    nextConnector();
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::scheduleNextConnector()
+{
+    if(_factory->_connectionAttemptDelay == 0)
+    {
+        return;
+    }
+
+    {
+        lock_guard lock(_mutex);
+        if(_connected || _iter == _connectors.end())
+        {
+            return;
+        }
+    }
+
+    try
+    {
+        IceUtil::TimerPtr timer = _instance->timer();
+        timer->cancel(shared_from_this());
+        timer->schedule(shared_from_this(), chrono::milliseconds(_factory->_connectionAttemptDelay));
+    }
+    catch(const CommunicatorDestroyedException&)
+    {
+    }
+    catch(const IceUtil::IllegalArgumentException&)
+    {
+        // Expected if the timer is destroyed or if another thread scheduled the next attempt concurrently.
+    }
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::cancelNextConnector()
+{
+    if(_factory->_connectionAttemptDelay == 0)
+    {
+        return;
+    }
+
+    try
+    {
+        _instance->timer()->cancel(shared_from_this());
+    }
+    catch(const CommunicatorDestroyedException&)
     {
-        _factory->finishGetConnection(_connectors, ex, shared_from_this());
     }
-    return false;
 }
 
 void
@@ -21,6 +21,7 @@
 #include <Ice/InstrumentationF.h>
 #include <Ice/ACMF.h>
 #include <Ice/Comparable.h>
+#include <IceUtil/Timer.h>
 
 #include <condition_variable>
 #include <list>
@@ -56,6 +57,8 @@ public:
         std::function<void(Ice::ConnectionIPtr, bool)>,
         std::function<void(std::exception_ptr)>);
 
+    Ice::ConnectionIPtr getPooledConnection(const Ice::ConnectionIPtr&);
+
     void setRouterInfo(const RouterInfoPtr&);
     void removeAdapter(const Ice::ObjectAdapterPtr&);
     void flushAsyncBatchRequests(const CommunicatorFlushBatchAsyncPtr&, Ice::CompressBatch);
@@ -78,7 +81,12 @@ private:
         EndpointIPtr endpoint;
     };
 
-    class ConnectCallback final : public std::enable_shared_from_this<ConnectCallback>
+    //
+    // When Ice.ConnectionAttemptDelay is greater than 0, the connection attempts are staggered: the next connector is
+    // tried when the previous attempt fails or when the delay expires, whichever comes first. The first connection to
+    // be validated is kept and the attempts still in progress are aborted.
+    //
+    class ConnectCallback final : public IceUtil::TimerTask, public std::enable_shared_from_this<ConnectCallback>
     {
     public:
 
@@ -100,6 +108,8 @@ private:
         void getConnectors();
         void nextEndpoint();
 
+        void addConnection(const ConnectorInfo&);
+
         void getConnection();
         void nextConnector();
 
@@ -110,9 +120,23 @@ private:
         bool removeConnectors(const std::vector<ConnectorInfo>&);
         void removeFromPending();
 
+        void runTimerTask() final;
+
     private:
 
-        bool connectionStartFailedImpl(std::exception_ptr);
+        struct Attempt
+        {
+            Attempt(const ConnectorInfo& c, const Ice::Instrumentation::ObserverPtr& o) : connector(c), observer(o)
+            {
+            }
+
+            ConnectorInfo connector;
+            Ice::Instrumentation::ObserverPtr observer;
+        };
+
+        bool connectionStartFailedImpl(const Ice::Instrumentation::ObserverPtr&, std::exception_ptr);
+        void scheduleNextConnector();
+        void cancelNextConnector();
 
         const InstancePtr _instance;
         const OutgoingConnectionFactoryPtr _factory;
@@ -121,10 +145,14 @@ private:
         const std::function<void(Ice::ConnectionIPtr, bool)> _createConnectionResponse;
         const std::function<void(std::exception_ptr)> _createConnectionException;
         const Ice::EndpointSelectionType _selType;
-        Ice::Instrumentation::ObserverPtr _observer;
         std::vector<EndpointIPtr>::const_iterator _endpointsIter;
         std::vector<ConnectorInfo> _connectors;
-        std::vector<ConnectorInfo>::const_iterator _iter;
+        std::vector<ConnectorInfo>::const_iterator _iter; // The next connector to try.
+
+        std::mutex _mutex;
+        std::map<Ice::ConnectionIPtr, Attempt> _attempts;
+        int _attemptCount; // The number of attempts in progress, including the ones not yet in _attempts.
+        bool _connected;
     };
     using ConnectCallbackPtr = std::shared_ptr<ConnectCallback>;
     friend class ConnectCallback;
@@ -150,6 +178,8 @@ private:
     Ice::CommunicatorPtr _communicator;
     const InstancePtr _instance;
     const FactoryACMMonitorPtr _monitor;
+    const int _connectionPoolSize;
+    const int _connectionAttemptDelay;
     bool _destroyed;
 
     using ConnectCallbackSet = std::set<ConnectCallbackPtr>;
@@ -22,12 +22,9 @@
 #include <Ice/ReferenceFactory.h> // For createProxy().
 #include <Ice/ProxyFactory.h> // For createProxy().
 #include <Ice/BatchRequestQueue.h>
+#include <Ice/CompressionCodec.h>
 #include "CheckIdentity.h"
 
-#ifdef ICE_HAS_BZIP2
-#  include <bzlib.h>
-#endif
-
 using namespace std;
 using namespace Ice;
 using namespace Ice::Instrumentation;
@@ -72,7 +69,8 @@ public:
         const ObjectAdapterPtr& adapter,
         const OutgoingAsyncBasePtr& outAsync,
         const HeartbeatCallback& heartbeatCallback,
-        InputStream& stream) :
+        InputStream& stream,
+        const vector<ConnectionI::ReadAheadMessagePtr>& readAheadMessages) :
         DispatchWorkItem(connection),
         _connection(connection),
         _connectionStartCompleted(std::move(connectionStartCompleted)),
@@ -84,7 +82,8 @@ public:
         _adapter(adapter),
         _outAsync(outAsync),
         _heartbeatCallback(heartbeatCallback),
-        _stream(stream.instance(), currentProtocolEncoding)
+        _stream(stream.instance(), currentProtocolEncoding),
+        _readAheadMessages(readAheadMessages)
     {
         _stream.swap(stream);
     }
@@ -93,7 +92,7 @@ public:
     run()
     {
         _connection->dispatch(_connectionStartCompleted, _sentCBs, _compress, _requestId, _invokeNum, _servantManager, _adapter,
-                              _outAsync, _heartbeatCallback, _stream);
+                              _outAsync, _heartbeatCallback, _stream, _readAheadMessages);
     }
 
 private:
@@ -109,6 +108,7 @@ private:
     const OutgoingAsyncBasePtr _outAsync;
     const HeartbeatCallback _heartbeatCallback;
     InputStream _stream;
+    const vector<ConnectionI::ReadAheadMessagePtr> _readAheadMessages;
 };
 
 class FinishCall : public DispatchWorkItem
@@ -500,6 +500,11 @@ Ice::ConnectionI::destroy(DestructionReason reason)
 void
 Ice::ConnectionI::close(ConnectionClose mode) noexcept
 {
+    if(_sendQueueEnabled)
+    {
+        flushSendQueue(nullptr); // Send the requests submitted before the connection is closed.
+    }
+
     std::unique_lock lock(_mutex);
 
     if(mode == ConnectionClose::Forcefully)
@@ -535,6 +540,22 @@ Ice::ConnectionI::isActiveOrHolding() const
     return _state > StateNotValidated && _state < StateClosing;
 }
 
+int
+Ice::ConnectionI::getOutstandingRequestCount() const
+{
+    std::lock_guard lock(_mutex);
+
+    if(_state <= StateNotValidated || _state >= StateClosing)
+    {
+        return -1;
+    }
+
+    //
+    // The requests waiting for a reply and the messages queued for sending.
+    //
+    return static_cast<int>(_asyncRequests.size() + _sendStreams.size());
+}
+
 bool
 Ice::ConnectionI::isFinished() const
 {
@@ -686,9 +707,125 @@ Ice::ConnectionI::monitor(const chrono::steady_clock::time_point& now, const ACM
 AsyncStatus
 Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compress, bool response, int batchRequestNum)
 {
-    OutputStream* os = out->getOs();
+    if(_sendQueueEnabled)
+    {
+        //
+        // Proxy requests are pushed to the lock-free send queue and sent by the thread draining
+        // the queue. The other requests (heartbeats, connection batch flushes) are sent directly.
+        //
+        ProxyOutgoingAsyncBasePtr proxyOut = dynamic_pointer_cast<ProxyOutgoingAsyncBase>(out);
+        if(proxyOut)
+        {
+            SendQueueRequest* request = new SendQueueRequest(proxyOut, compress, response, batchRequestNum);
+            request->next = _sendQueue.load();
+            while(!_sendQueue.compare_exchange_weak(request->next, request))
+            {
+            }
+            return flushSendQueue(request);
+        }
+    }
 
     std::lock_guard lock(_mutex);
+    return sendRequest(out, compress, response, batchRequestNum);
+}
+
+AsyncStatus
+Ice::ConnectionI::flushSendQueue(const SendQueueRequest* request)
+{
+    //
+    // Only one thread drains the send queue at a time. A thread which fails to become the drainer
+    // returns right away: its request is sent by the current drainer, which checks the queue again
+    // after releasing the draining flag. The status of requests sent on behalf of other threads is
+    // reported through the request callbacks, the same way as requests queued for sending.
+    //
+    AsyncStatus status = AsyncStatusQueued;
+    exception_ptr exception;
+    while(!_sendQueueDraining.exchange(true))
+    {
+        vector<unique_ptr<SendQueueRequest>> requests;
+        for(SendQueueRequest* p = _sendQueue.exchange(nullptr); p; p = p->next)
+        {
+            requests.emplace_back(p);
+        }
+        reverse(requests.begin(), requests.end()); // Send the requests in submission order.
+
+        vector<pair<AsyncStatus, exception_ptr>> results;
+        results.reserve(requests.size());
+        {
+            std::lock_guard lock(_mutex);
+            for(const auto& r : requests)
+            {
+                try
+                {
+                    results.emplace_back(sendRequest(r->outAsync, r->compress, r->response, r->batchRequestNum),
+                                         nullptr);
+                }
+                catch(...)
+                {
+                    results.emplace_back(AsyncStatusQueued, current_exception());
+                }
+            }
+        }
+        _sendQueueDraining = false;
+
+        for(size_t i = 0; i < requests.size(); ++i)
+        {
+            if(requests[i].get() == request)
+            {
+                status = results[i].first;
+                exception = results[i].second;
+                request = nullptr;
+                continue;
+            }
+
+            const ProxyOutgoingAsyncBasePtr& out = requests[i]->outAsync;
+            if(!results[i].second)
+            {
+                if(results[i].first & AsyncStatusInvokeSentCallback)
+                {
+                    out->invokeSentAsync();
+                }
+                continue;
+            }
+
+            try
+            {
+                rethrow_exception(results[i].second);
+            }
+            catch(const RetryException&)
+            {
+                out->retryException();
+            }
+            catch(const Ice::LocalException&)
+            {
+                if(out->exception(current_exception()))
+                {
+                    out->invokeExceptionAsync();
+                }
+            }
+        }
+
+        if(!_sendQueue.load())
+        {
+            break;
+        }
+    }
+
+    if(exception)
+    {
+        rethrow_exception(exception);
+    }
+    return status;
+}
+
+AsyncStatus
+Ice::ConnectionI::sendRequest(const OutgoingAsyncBasePtr& out, bool compress, bool response, int batchRequestNum)
+{
+    //
+    // Must be called with the connection mutex locked.
+    //
+    OutputStream* os = out->getOs();
+
     //
     // If the exception is closed before we even have a chance
     // to send our request, we always try to send the request
@@ -1049,10 +1186,11 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, exc
             catch (const std::exception&)
             {
                 //
-                // If the request is being sent, don't remove it from the send streams,
-                // it will be removed once the sending is finished.
+                // If the request is being sent or if it was prepared to be sent with
+                // the request being sent, don't remove it from the send streams, it
+                // will be removed once the sending is finished.
                 //
-                if(o == _sendStreams.begin())
+                if(o == _sendStreams.begin() || o->stream->i)
                 {
                     o->canceled(true); // true = adopt the stream
                 }
@@ -1415,6 +1553,7 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
     ObjectAdapterPtr adapter;
     OutgoingAsyncBasePtr outAsync;
     HeartbeatCallback heartbeatCallback;
+    vector<ReadAheadMessagePtr> readAheadMessages;
     int dispatchCount = 0;
 
     ThreadPoolMessage<ConnectionI> msg(current, *this);
@@ -1445,103 +1584,28 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                 {
                     _observer.startWrite(_writeStream);
                 }
-                writeOp = write(_writeStream);
+                writeOp = writeSendStreams();
                 if(_observer && !(writeOp & SocketOperationWrite))
                 {
                     _observer.finishWrite(_writeStream);
                 }
             }
 
-            while(readyOp & SocketOperationRead)
+            if(readyOp & SocketOperationRead)
             {
-                if(_observer && !_readHeader)
-                {
-                    _observer.startRead(_readStream);
-                }
-
-                readOp = read(_readStream);
-                if(readOp & SocketOperationRead)
-                {
-                    break;
-                }
-                if(_observer && !_readHeader)
-                {
-                    assert(_readStream.i == _readStream.b.end());
-                    _observer.finishRead(_readStream);
-                }
-
-                if(_readHeader) // Read header if necessary.
+                //
+                // Clear the read ready status set if messages were left in the
+                // read-ahead buffer by the previous call, the transceiver
+                // updates its own status when we read from it.
+                //
+                if(_readAheadReady)
                 {
-                    _readHeader = false;
-
-                    if(_observer)
-                    {
-                        _observer->receivedBytes(static_cast<int>(headerSize));
-                    }
-
-                    //
-                    // Connection is validated on first message. This is only used by
-                    // setState() to check wether or not we can print a connection
-                    // warning (a client might close the connection forcefully if the
-                    // connection isn't validated, we don't want to print a warning
-                    // in this case).
-                    //
-                    _validated = true;
-
-                    ptrdiff_t pos = _readStream.i - _readStream.b.begin();
-                    if(pos < headerSize)
-                    {
-                        //
-                        // This situation is possible for small UDP packets.
-                        //
-                        throw IllegalMessageSizeException(__FILE__, __LINE__);
-                    }
-
-                    _readStream.i = _readStream.b.begin();
-                    const Byte* m;
-                    _readStream.readBlob(m, static_cast<int32_t>(sizeof(magic)));
-                    if(m[0] != magic[0] || m[1] != magic[1] || m[2] != magic[2] || m[3] != magic[3])
-                    {
-                        throw BadMagicException(__FILE__, __LINE__, "", Ice::ByteSeq(&m[0], &m[0] + sizeof(magic)));
-                    }
-                    ProtocolVersion pv;
-                    _readStream.read(pv);
-                    checkSupportedProtocol(pv);
-                    EncodingVersion ev;
-                    _readStream.read(ev);
-                    checkSupportedProtocolEncoding(ev);
-
-                    Byte messageType;
-                    _readStream.read(messageType);
-                    Byte compressByte;
-                    _readStream.read(compressByte);
-                    int32_t size;
-                    _readStream.read(size);
-                    if(size < headerSize)
-                    {
-                        throw IllegalMessageSizeException(__FILE__, __LINE__);
-                    }
-
-                    if(size > static_cast<int32_t>(_messageSizeMax))
-                    {
-                        Ex::throwMemoryLimitException(__FILE__, __LINE__, static_cast<size_t>(size), _messageSizeMax);
-                    }
-                    if(static_cast<size_t>(size) > _readStream.b.size())
-                    {
-                        _readStream.b.resize(static_cast<size_t>(size));
-                    }
-                    _readStream.i = _readStream.b.begin() + pos;
+                    _transceiver->getNativeInfo()->ready(SocketOperationRead, false);
+                    _readAheadReady = false;
                 }
+                _readAheadFilled = false;
 
-                if(_readStream.i != _readStream.b.end())
-                {
-                    if(_endpoint->datagram())
-                    {
-                        throw DatagramLimitException(__FILE__, __LINE__); // The message was truncated.
-                    }
-                    continue;
-                }
-                break;
+                readOp = readMessage();
             }
 
             SocketOperation newOp = static_cast<SocketOperation>(readOp | writeOp);
@@ -1604,6 +1668,71 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                                                                               outAsync,
                                                                               heartbeatCallback,
                                                                               dispatchCount));
+
+                    //
+                    // In read-ahead mode, also parse the messages already in the
+                    // read-ahead buffer. If the transceiver wasn't read yet, we read
+                    // from it until it would block to make sure its read ready
+                    // status is up to date. Datagram transceivers can also receive
+                    // several datagrams with a single system call, we parse all of
+                    // them.
+                    //
+                    while((_state == StateActive || _state == StateClosing) &&
+                          (_readAheadSize > 0 ? !_readAheadFilled || hasReadAheadMessage() :
+                           _transceiver->hasBufferedData()))
+                    {
+                        SocketOperation op;
+                        try
+                        {
+                            op = readMessage();
+                        }
+                        catch(const LocalException& ex)
+                        {
+                            if(_endpoint->datagram())
+                            {
+                                discardDatagram(ex);
+                                continue;
+                            }
+
+                            //
+                            // Close the connection but still dispatch the messages
+                            // parsed so far, their replies or requests were received.
+                            //
+                            setState(StateClosed, current_exception());
+                            break;
+                        }
+                        newOp = static_cast<SocketOperation>(newOp | op);
+                        if(op & SocketOperationRead)
+                        {
+                            break;
+                        }
+
+                        auto message = make_shared<ReadAheadMessage>(_instance.get());
+                        newOp = static_cast<SocketOperation>(newOp | parseMessage(message->stream,
+                                                                                  message->invokeNum,
+                                                                                  message->requestId,
+                                                                                  message->compress,
+                                                                                  message->servantManager,
+                                                                                  message->adapter,
+                                                                                  message->outAsync,
+                                                                                  message->heartbeatCallback,
+                                                                                  dispatchCount));
+                        if(message->invokeNum || message->outAsync || message->heartbeatCallback)
+                        {
+                            readAheadMessages.push_back(message);
+                        }
+                    }
+
+                    if(hasReadAheadMessage())
+                    {
+                        //
+                        // Messages are left in the read-ahead buffer, the socket might
+                        // not be readable anymore so we set the read ready status to
+                        // get called again by the thread pool.
+                        //
+                        _transceiver->getNativeInfo()->ready(SocketOperationRead, true);
+                        _readAheadReady = true;
+                    }
                 }
 
                 if(readyOp & SocketOperationWrite)
@@ -1635,16 +1764,9 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
             _dispatchCount += dispatchCount;
             io.completed();
         }
-        catch(const DatagramLimitException&) // Expected.
+        catch(const DatagramLimitException& ex) // Expected.
         {
-            if(_warnUdp)
-            {
-                Warning out(_instance->initializationData().logger);
-                out << "maximum datagram size of " << _readStream.i - _readStream.b.begin() << " exceeded";
-            }
-            _readStream.resize(headerSize);
-            _readStream.i = _readStream.b.begin();
-            _readHeader = true;
+            discardDatagram(ex);
             return;
         }
         catch(const SocketException&)
@@ -1656,14 +1778,7 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
         {
             if(_endpoint->datagram())
             {
-                if(_warn)
-                {
-                    Warning out(_instance->initializationData().logger);
-                    out << "datagram connection exception:\n" << ex << '\n' << _desc;
-                }
-                _readStream.resize(headerSize);
-                _readStream.i = _readStream.b.begin();
-                _readHeader = true;
+                discardDatagram(ex);
             }
             else
             {
@@ -1687,7 +1802,8 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                 adapter,
                 outAsync,
                 heartbeatCallback,
-                current.stream));
+                current.stream,
+                readAheadMessages));
 #else
     if(!_dispatcher) // Optimization, call dispatch() directly if there's no dispatcher.
     {
@@ -1701,7 +1817,8 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
             adapter,
             outAsync,
             heartbeatCallback,
-            current.stream);
+            current.stream,
+            readAheadMessages);
     }
     else
     {
@@ -1717,7 +1834,8 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                 adapter,
                 outAsync,
                 heartbeatCallback,
-                current.stream));
+                current.stream,
+                readAheadMessages));
 
     }
 #endif
@@ -1727,7 +1845,8 @@ void
 ConnectionI::dispatch(function<void(ConnectionIPtr)> connectionStartCompleted, const vector<OutgoingMessage>& sentCBs,
                       Byte compress, int32_t requestId, int32_t invokeNum, const ServantManagerPtr& servantManager,
                       const ObjectAdapterPtr& adapter, const OutgoingAsyncBasePtr& outAsync,
-                      const HeartbeatCallback& heartbeatCallback, InputStream& stream)
+                      const HeartbeatCallback& heartbeatCallback, InputStream& stream,
+                      const vector<ReadAheadMessagePtr>& readAheadMessages)
 {
     int dispatchedCount = 0;
 
@@ -1778,11 +1897,11 @@ ConnectionI::dispatch(function<void(ConnectionIPtr)> connectionStartCompleted, c
         ++dispatchedCount;
     }
 
-    if(heartbeatCallback)
+    auto invokeHeartbeatCallback = [this](const HeartbeatCallback& callback)
     {
         try
         {
-            heartbeatCallback(shared_from_this());
+            callback(shared_from_this());
         }
         catch(const std::exception& ex)
         {
@@ -1794,6 +1913,11 @@ ConnectionI::dispatch(function<void(ConnectionIPtr)> connectionStartCompleted, c
             Error out(_instance->initializationData().logger);
             out << "connection callback exception:\nunknown c++ exception" << '\n' << _desc;
         }
+    };
+
+    if(heartbeatCallback)
+    {
+        invokeHeartbeatCallback(heartbeatCallback);
         ++dispatchedCount;
     }
 
@@ -1812,6 +1936,31 @@ ConnectionI::dispatch(function<void(ConnectionIPtr)> connectionStartCompleted, c
         //
     }
 
+    //
+    // Dispatch the messages parsed from the read-ahead buffer after the
+    // first message, in the order they were received.
+    //
+    for(const auto& message : readAheadMessages)
+    {
+        if(message->outAsync)
+        {
+            message->outAsync->invokeResponse();
+            ++dispatchedCount;
+        }
+
+        if(message->heartbeatCallback)
+        {
+            invokeHeartbeatCallback(message->heartbeatCallback);
+            ++dispatchedCount;
+        }
+
+        if(message->invokeNum)
+        {
+            invokeAll(message->stream, message->invokeNum, message->requestId, message->compress,
+                      message->servantManager, message->adapter);
+        }
+    }
+
     //
     // Decrease dispatch count.
     //
@@ -2029,6 +2178,9 @@ Ice::ConnectionI::finish(bool close)
     _writeStream.b.clear();
     _readStream.clear();
     _readStream.b.clear();
+    _readAheadBuffer.b.clear();
+    _readAheadBuffer.i = _readAheadBuffer.b.begin();
+    _readAheadPos = _readAheadBuffer.b.begin();
 
     if(_closeCallback)
     {
@@ -2152,12 +2304,33 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _warn(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Connections") > 0),
     _warnUdp(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Datagrams") > 0),
     _compressionLevel(1),
+    _compressionCodecManager(_instance->compressionCodecManager()),
+    _compressionCodec(_compressionCodecManager->get(bzip2CompressionCodec)),
+    _compressionMinSize(static_cast<size_t>(
+        max(0, _instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.Compression.MinSize", 100)))),
+    _compressionAdaptive(_instance->initializationData().properties->getPropertyAsInt("Ice.Compression.Adaptive") > 0),
+    _compressionRatio(0.0),
+    _compressionSkip(0),
+    _compressionBackoff(16),
     _nextRequestId(1),
     _asyncRequestsHint(_asyncRequests.end()),
     _messageSizeMax(adapter ? adapter->messageSizeMax() : _instance->messageSizeMax()),
-    _batchRequestQueue(new BatchRequestQueue(instance, endpoint->datagram())),
+    _writeCoalesceSize(_instance->writeCoalesceSize()),
+#if defined(ICE_USE_IOCP)
+    _readAheadSize(0),
+#else
+    _readAheadSize(endpoint->datagram() ? 0 : _instance->readAheadSize()),
+#endif
+    _batchRequestQueue(new BatchRequestQueue(instance, endpoint->datagram(), instance->batchAutoFlushSize(),
+                                             instance->batchAutoFlushDelay())),
+    _sendQueueEnabled(_instance->sendQueue()),
+    _sendQueue(nullptr),
+    _sendQueueDraining(false),
     _readStream(_instance.get(), Ice::currentProtocolEncoding),
     _readHeader(false),
+    _readAheadPos(_readAheadBuffer.b.begin()),
+    _readAheadReady(false),
+    _readAheadFilled(false),
     _writeStream(_instance.get(), Ice::currentProtocolEncoding),
     _dispatchCount(0),
     _state(StateNotInitialized),
@@ -2221,6 +2394,7 @@ Ice::ConnectionI::~ConnectionI()
     assert(_state == StateFinished);
     assert(_dispatchCount == 0);
     assert(_sendStreams.empty());
+    assert(!_sendQueue.load());
     assert(_asyncRequests.empty());
 }
 
@@ -2619,7 +2793,7 @@ Ice::ConnectionI::validate(SocketOperation operation)
                 _writeStream.write(currentProtocol);
                 _writeStream.write(currentProtocolEncoding);
                 _writeStream.write(validateConnectionMsg);
-                _writeStream.write(static_cast<Byte>(0)); // Compression status (always zero for validate connection).
+                _writeStream.write(_compressionCodecManager->supported()); // Compression codecs supported besides bzip2.
                 _writeStream.write(headerSize); // Message size.
                 _writeStream.i = _writeStream.b.begin();
                 traceSend(_writeStream, _logger, _traceLevels);
@@ -2648,67 +2822,115 @@ Ice::ConnectionI::validate(SocketOperation operation)
         }
         else // The client side has the passive role for connection validation.
         {
-            if(_readStream.b.empty())
+            if(_writeStream.b.empty())
             {
-                _readStream.b.resize(headerSize);
-                _readStream.i = _readStream.b.begin();
-            }
+                if(_readStream.b.empty())
+                {
+                    _readStream.b.resize(headerSize);
+                    _readStream.i = _readStream.b.begin();
+                }
 
-            if(_observer)
-            {
-                _observer.startRead(_readStream);
-            }
+                if(_observer)
+                {
+                    _observer.startRead(_readStream);
+                }
 
-            if(_readStream.i != _readStream.b.end())
-            {
-                SocketOperation op = read(_readStream);
-                if(op)
+                if(_readStream.i != _readStream.b.end())
                 {
-                    scheduleTimeout(op);
-                    _threadPool->update(shared_from_this(), operation, op);
-                    return false;
+                    SocketOperation op = read(_readStream);
+                    if(op)
+                    {
+                        scheduleTimeout(op);
+                        _threadPool->update(shared_from_this(), operation, op);
+                        return false;
+                    }
                 }
-            }
 
-            if(_observer)
-            {
-                _observer.finishRead(_readStream);
-            }
+                if(_observer)
+                {
+                    _observer.finishRead(_readStream);
+                }
 
-            _validated = true;
+                _validated = true;
 
-            assert(_readStream.i == _readStream.b.end());
-            _readStream.i = _readStream.b.begin();
-            Byte m[4];
-            _readStream.read(m[0]);
-            _readStream.read(m[1]);
-            _readStream.read(m[2]);
-            _readStream.read(m[3]);
-            if(m[0] != magic[0] || m[1] != magic[1] || m[2] != magic[2] || m[3] != magic[3])
-            {
-                throw BadMagicException(__FILE__, __LINE__, "", Ice::ByteSeq(&m[0], &m[0] + sizeof(magic)));
-            }
-            ProtocolVersion pv;
-            _readStream.read(pv);
-            checkSupportedProtocol(pv);
-            EncodingVersion ev;
-            _readStream.read(ev);
-            checkSupportedProtocolEncoding(ev);
-            Byte messageType;
-            _readStream.read(messageType);
-            if(messageType != validateConnectionMsg)
-            {
-                throw ConnectionNotValidatedException(__FILE__, __LINE__);
+                assert(_readStream.i == _readStream.b.end());
+                _readStream.i = _readStream.b.begin();
+                Byte m[4];
+                _readStream.read(m[0]);
+                _readStream.read(m[1]);
+                _readStream.read(m[2]);
+                _readStream.read(m[3]);
+                if(m[0] != magic[0] || m[1] != magic[1] || m[2] != magic[2] || m[3] != magic[3])
+                {
+                    throw BadMagicException(__FILE__, __LINE__, "", Ice::ByteSeq(&m[0], &m[0] + sizeof(magic)));
+                }
+                ProtocolVersion pv;
+                _readStream.read(pv);
+                checkSupportedProtocol(pv);
+                EncodingVersion ev;
+                _readStream.read(ev);
+                checkSupportedProtocolEncoding(ev);
+                Byte messageType;
+                _readStream.read(messageType);
+                if(messageType != validateConnectionMsg)
+                {
+                    throw ConnectionNotValidatedException(__FILE__, __LINE__);
+                }
+                Byte compress;
+                _readStream.read(compress); // Compression codecs supported by the server besides bzip2.
+                int32_t size;
+                _readStream.read(size);
+                if(size != headerSize)
+                {
+                    throw IllegalMessageSizeException(__FILE__, __LINE__);
+                }
+                traceRecv(_readStream, _logger, _traceLevels);
+
+                //
+                // Select the compression codec and let the server know with a
+                // validate connection message if it's not bzip2, the only codec
+                // supported by peers which don't negotiate the codec.
+                //
+                _compressionCodec = _compressionCodecManager->select(compress);
+                if(_compressionCodec && _compressionCodec->id() != bzip2CompressionCodec)
+                {
+                    _writeStream.write(magic[0]);
+                    _writeStream.write(magic[1]);
+                    _writeStream.write(magic[2]);
+                    _writeStream.write(magic[3]);
+                    _writeStream.write(currentProtocol);
+                    _writeStream.write(currentProtocolEncoding);
+                    _writeStream.write(validateConnectionMsg);
+                    _writeStream.write(_compressionCodec->id()); // Compression codec selected by the client.
+                    _writeStream.write(headerSize); // Message size.
+                    _writeStream.i = _writeStream.b.begin();
+                    traceSend(_writeStream, _logger, _traceLevels);
+                }
             }
-            Byte compress;
-            _readStream.read(compress); // Ignore compression status for validate connection.
-            int32_t size;
-            _readStream.read(size);
-            if(size != headerSize)
+
+            if(!_writeStream.b.empty())
             {
-                throw IllegalMessageSizeException(__FILE__, __LINE__);
+                if(_observer)
+                {
+                    _observer.startWrite(_writeStream);
+                }
+
+                if(_writeStream.i != _writeStream.b.end())
+                {
+                    SocketOperation op = write(_writeStream);
+                    if(op)
+                    {
+                        scheduleTimeout(op);
+                        _threadPool->update(shared_from_this(), operation, op);
+                        return false;
+                    }
+                }
+
+                if(_observer)
+                {
+                    _observer.finishWrite(_writeStream);
+                }
             }
-            traceRecv(_readStream, _logger, _traceLevels);
         }
     }
 
@@ -2795,66 +3017,23 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
             // Otherwise, prepare the next message stream for writing.
             //
             message = &_sendStreams.front();
-            assert(!message->stream->i);
-#ifdef ICE_HAS_BZIP2
-            if(message->compress && message->stream->b.size() >= 100) // Only compress messages > 100 bytes.
+            if(!message->stream->i)
             {
-                //
-                // Message compressed. Request compressed response, if any.
-                //
-                message->stream->b[9] = 2;
-
-                //
-                // Do compression.
-                //
-                OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
-                doCompress(*message->stream, stream);
-
-                traceSend(*message->stream, _logger, _traceLevels);
+                prepareMessage(*message);
+            }
+            _writeStream.swap(*message->stream);
 
-                message->adopt(&stream); // Adopt the compressed stream.
-                message->stream->i = message->stream->b.begin();
+            //
+            // Send the message.
+            //
+            if(_observer)
+            {
+                _observer.startWrite(_writeStream);
             }
-            else
+            assert(_writeStream.i);
+            if(_writeStream.i != _writeStream.b.end())
             {
-#endif
-                if(message->compress)
-                {
-                    //
-                    // Message not compressed. Request compressed response, if any.
-                    //
-                    message->stream->b[9] = 1;
-                }
-
-                //
-                // No compression, just fill in the message size.
-                //
-                int32_t sz = static_cast<int32_t>(message->stream->b.size());
-                const Byte* p = reinterpret_cast<const Byte*>(&sz);
-#ifdef ICE_BIG_ENDIAN
-                reverse_copy(p, p + sizeof(int32_t), message->stream->b.begin() + 10);
-#else
-                copy(p, p + sizeof(int32_t), message->stream->b.begin() + 10);
-#endif
-                message->stream->i = message->stream->b.begin();
-                traceSend(*message->stream, _logger, _traceLevels);
-
-#ifdef ICE_HAS_BZIP2
-            }
-#endif
-            _writeStream.swap(*message->stream);
-
-            //
-            // Send the message.
-            //
-            if(_observer)
-            {
-                _observer.startWrite(_writeStream);
-            }
-            assert(_writeStream.i);
-            if(_writeStream.i != _writeStream.b.end())
-            {
-                SocketOperation op = write(_writeStream);
+                SocketOperation op = writeSendStreams();
                 if(op)
                 {
                     return op;
@@ -2887,6 +3066,53 @@ Ice::ConnectionI::sendNextMessage(vector<OutgoingMessage>& callbacks)
     return SocketOperationNone;
 }
 
+void
+Ice::ConnectionI::prepareMessage(OutgoingMessage& message)
+{
+    assert(!message.stream->i);
+    //
+    // Only compress messages larger than Ice.Compression.MinSize bytes. The
+    // message is still sent uncompressed if doCompress() decides it doesn't
+    // pay off.
+    //
+    OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
+    if(message.compress && _compressionCodec && message.stream->b.size() >= _compressionMinSize &&
+       doCompress(*message.stream, stream))
+    {
+        //
+        // Message compressed. Request compressed response, if any.
+        //
+        traceSend(*message.stream, _logger, _traceLevels);
+
+        message.adopt(&stream); // Adopt the compressed stream.
+        message.stream->i = message.stream->b.begin();
+    }
+    else
+    {
+        if(message.compress)
+        {
+            //
+            // Message not compressed. Request compressed response, if any.
+            //
+            message.stream->b[9] = 1;
+        }
+
+        //
+        // No compression, just fill in the message size.
+        //
+        int32_t sz = static_cast<int32_t>(message.stream->b.size());
+        const Byte* p = reinterpret_cast<const Byte*>(&sz);
+#ifdef ICE_BIG_ENDIAN
+        reverse_copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
+#else
+        copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
+#endif
+        message.stream->i = message.stream->b.begin();
+        traceSend(*message.stream, _logger, _traceLevels);
+
+    }
+}
+
 AsyncStatus
 Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 {
@@ -2908,19 +3134,18 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 
     message.stream->i = message.stream->b.begin();
     SocketOperation op;
-#ifdef ICE_HAS_BZIP2
-    if(message.compress && message.stream->b.size() >= 100) // Only compress messages larger than 100 bytes.
+    //
+    // Only compress messages larger than Ice.Compression.MinSize bytes. The
+    // message is still sent uncompressed if doCompress() decides it doesn't
+    // pay off.
+    //
+    OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
+    if(message.compress && _compressionCodec && message.stream->b.size() >= _compressionMinSize &&
+       doCompress(*message.stream, stream))
     {
         //
         // Message compressed. Request compressed response, if any.
         //
-        message.stream->b[9] = 2;
-
-        //
-        // Do compression.
-        //
-        OutputStream stream(_instance.get(), Ice::currentProtocolEncoding);
-        doCompress(*message.stream, stream);
         stream.i = stream.b.begin();
 
         traceSend(*message.stream, _logger, _traceLevels);
@@ -2957,7 +3182,6 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     }
     else
     {
-#endif
         if(message.compress)
         {
             //
@@ -3008,9 +3232,7 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 
         _sendStreams.push_back(message);
         _sendStreams.back().adopt(0); // Adopt the stream.
-#ifdef ICE_HAS_BZIP2
     }
-#endif
 
     _writeStream.swap(*_sendStreams.back().stream);
     scheduleTimeout(op);
@@ -3018,89 +3240,78 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     return AsyncStatusQueued;
 }
 
-#ifdef ICE_HAS_BZIP2
-static string
-getBZ2Error(int bzError)
+bool
+Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compressed)
 {
-    if(bzError == BZ_RUN_OK)
-    {
-        return ": BZ_RUN_OK";
-    }
-    else if(bzError == BZ_FLUSH_OK)
-    {
-        return ": BZ_FLUSH_OK";
-    }
-    else if(bzError == BZ_FINISH_OK)
-    {
-        return ": BZ_FINISH_OK";
-    }
-    else if(bzError == BZ_STREAM_END)
-    {
-        return ": BZ_STREAM_END";
-    }
-    else if(bzError == BZ_CONFIG_ERROR)
-    {
-        return ": BZ_CONFIG_ERROR";
-    }
-    else if(bzError == BZ_SEQUENCE_ERROR)
-    {
-        return ": BZ_SEQUENCE_ERROR";
-    }
-    else if(bzError == BZ_PARAM_ERROR)
-    {
-        return ": BZ_PARAM_ERROR";
-    }
-    else if(bzError == BZ_MEM_ERROR)
-    {
-        return ": BZ_MEM_ERROR";
-    }
-    else if(bzError == BZ_DATA_ERROR)
-    {
-        return ": BZ_DATA_ERROR";
-    }
-    else if(bzError == BZ_DATA_ERROR_MAGIC)
-    {
-        return ": BZ_DATA_ERROR_MAGIC";
-    }
-    else if(bzError == BZ_IO_ERROR)
+    const Byte* p;
+
+    //
+    // With the adaptive policy, messages are sent uncompressed for a while
+    // after the recent compression ratio was poor.
+    //
+    if(_compressionSkip > 0)
     {
-        return ": BZ_IO_ERROR";
+        --_compressionSkip;
+        return false;
     }
-    else if(bzError == BZ_UNEXPECTED_EOF)
+
+    //
+    // Compress the message body, but not the header.
+    //
+    IceUtilInternal::StopWatch stopWatch;
+    stopWatch.start();
+    size_t uncompressedLen = uncompressed.b.size() - headerSize;
+    size_t compressedLen = _compressionCodec->compressBound(uncompressedLen);
+    compressed.b.resize(headerSize + sizeof(int32_t) + compressedLen);
+    compressedLen = _compressionCodec->compress(&uncompressed.b[0] + headerSize, uncompressedLen,
+                                                &compressed.b[0] + headerSize + sizeof(int32_t), compressedLen,
+                                                _compressionLevel);
+    compressed.b.resize(headerSize + sizeof(int32_t) + compressedLen);
+    int64_t time = stopWatch.stop().count();
+
+    if(_compressionAdaptive)
     {
-        return ": BZ_UNEXPECTED_EOF";
+        //
+        // Keep a moving average of the compression ratio. If it's poor, skip
+        // compression for the next messages, twice as many each time it's still
+        // poor when we try again.
+        //
+        double ratio = min(1.0, static_cast<double>(compressedLen + sizeof(int32_t)) /
+                                static_cast<double>(uncompressedLen));
+        _compressionRatio = _compressionRatio == 0.0 ? ratio : _compressionRatio * 0.75 + ratio * 0.25;
+        if(_compressionRatio > 0.9)
+        {
+            _compressionSkip = _compressionBackoff;
+            _compressionBackoff = min(_compressionBackoff * 2, 1024);
+        }
+        else
+        {
+            _compressionBackoff = 16;
+        }
     }
-    else if(bzError == BZ_OUTBUFF_FULL)
+
+    //
+    // Send the message uncompressed if compression doesn't reduce its size.
+    //
+    if(compressed.b.size() >= uncompressed.b.size())
     {
-        return ": BZ_OUTBUFF_FULL";
+        if(_observer)
+        {
+            _observer->compression(0, time);
+        }
+        compressed.b.clear();
+        return false;
     }
-    else
+
+    if(_observer)
     {
-        return "";
+        _observer->compression(static_cast<int>(uncompressed.b.size() - compressed.b.size()), time);
     }
-}
-
-void
-Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compressed)
-{
-    const Byte* p;
 
     //
-    // Compress the message body, but not the header.
+    // Set the compression status to the codec used to compress the message.
     //
-    unsigned int uncompressedLen = static_cast<unsigned int>(uncompressed.b.size() - headerSize);
-    unsigned int compressedLen = static_cast<unsigned int>(uncompressedLen * 1.01 + 600);
-    compressed.b.resize(headerSize + sizeof(int32_t) + compressedLen);
-    int bzError = BZ2_bzBuffToBuffCompress(reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(int32_t),
-                                           &compressedLen,
-                                           reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-                                           uncompressedLen,
-                                           _compressionLevel, 0, 0);
-    if(bzError != BZ_OK)
-    {
-        throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
-    }
-    compressed.b.resize(headerSize + sizeof(int32_t) + compressedLen);
+    uncompressed.b[9] = _compressionCodec->id();
 
     //
     // Write the size of the compressed stream into the header of the
@@ -3131,11 +3342,22 @@ Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compresse
     // Copy the header from the uncompressed stream to the compressed one.
     //
     copy(uncompressed.b.begin(), uncompressed.b.begin() + headerSize, compressed.b.begin());
+    return true;
 }
 
 void
 Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompressed)
 {
+    //
+    // The compression status is the identifier of the codec used to
+    // compress the message.
+    //
+    CompressionCodecPtr codec = _compressionCodecManager->get(compressed.b[9]);
+    if(!codec)
+    {
+        throw FeatureNotSupportedException(__FILE__, __LINE__, "Cannot uncompress compressed message");
+    }
+
     int32_t uncompressedSize;
     compressed.i = compressed.b.begin() + headerSize;
     compressed.read(uncompressedSize);
@@ -3150,21 +3372,20 @@ Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompresse
     }
     uncompressed.resize(static_cast<size_t>(uncompressedSize));
 
-    unsigned int uncompressedLen = static_cast<unsigned int>(uncompressedSize - headerSize);
-    unsigned int compressedLen = static_cast<unsigned int>(compressed.b.size() - headerSize - sizeof(int32_t));
-    int bzError = BZ2_bzBuffToBuffDecompress(reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-                                             &uncompressedLen,
-                                             reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(int32_t),
-                                             compressedLen,
-                                             0, 0);
-    if(bzError != BZ_OK)
+    IceUtilInternal::StopWatch stopWatch;
+    stopWatch.start();
+    size_t compressedLen = compressed.b.size() - headerSize - sizeof(int32_t);
+    codec->uncompress(&compressed.b[0] + headerSize + sizeof(int32_t), compressedLen,
+                      &uncompressed.b[0] + headerSize, static_cast<size_t>(uncompressedSize - headerSize));
+    int64_t time = stopWatch.stop().count();
+    if(_observer)
     {
-        throw CompressionException(__FILE__, __LINE__, "BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError));
+        _observer->compression(max(0, static_cast<int>(uncompressed.b.size()) - static_cast<int>(compressed.b.size())),
+                               time);
     }
 
     copy(compressed.b.begin(), compressed.b.begin() + headerSize, uncompressed.b.begin());
 }
-#endif
 
 SocketOperation
 Ice::ConnectionI::parseMessage(InputStream& stream, int32_t& invokeNum, int32_t& requestId, Byte& compress,
@@ -3194,15 +3415,15 @@ Ice::ConnectionI::parseMessage(InputStream& stream, int32_t& invokeNum, int32_t&
         stream.read(messageType);
         stream.read(compress);
 
-        if(compress == 2)
+        //
+        // The compression status of the validate connection message carries the
+        // compression codec selected by the client, it's not compressed.
+        //
+        if(compress >= bzip2CompressionCodec && messageType != validateConnectionMsg)
         {
-#ifdef ICE_HAS_BZIP2
             InputStream ustream(_instance.get(), Ice::currentProtocolEncoding);
             doUncompress(stream, ustream);
             stream.b.swap(ustream.b);
-#else
-            throw FeatureNotSupportedException(__FILE__, __LINE__, "Cannot uncompress compressed message");
-#endif
         }
         stream.i = stream.b.begin() + headerSize;
 
@@ -3354,7 +3575,20 @@ Ice::ConnectionI::parseMessage(InputStream& stream, int32_t& invokeNum, int32_t&
             case validateConnectionMsg:
             {
                 traceRecv(stream, _logger, _traceLevels);
-                if(_heartbeatCallback)
+                if(compress > bzip2CompressionCodec && !_connector)
+                {
+                    //
+                    // The client selected one of the compression codecs advertised
+                    // with our validate connection message, use it from now on.
+                    //
+                    CompressionCodecPtr codec = _compressionCodecManager->get(compress);
+                    if(!codec)
+                    {
+                        throw FeatureNotSupportedException(__FILE__, __LINE__, "unsupported compression codec");
+                    }
+                    _compressionCodec = codec;
+                }
+                else if(_heartbeatCallback)
                 {
                     heartbeatCallback = _heartbeatCallback;
                     ++dispatchCount;
@@ -3567,6 +3801,193 @@ ConnectionI::read(Buffer& buf)
     return op;
 }
 
+SocketOperation
+ConnectionI::readMessage()
+{
+    while(true)
+    {
+        if(_observer && !_readHeader)
+        {
+            _observer.startRead(_readStream);
+        }
+
+        SocketOperation readOp = readAhead(_readStream);
+        if(readOp & SocketOperationRead)
+        {
+            return readOp;
+        }
+        if(_observer && !_readHeader)
+        {
+            assert(_readStream.i == _readStream.b.end());
+            _observer.finishRead(_readStream);
+        }
+
+        if(_readHeader) // Read header if necessary.
+        {
+            _readHeader = false;
+
+            if(_observer)
+            {
+                _observer->receivedBytes(static_cast<int>(headerSize));
+            }
+
+            //
+            // Connection is validated on first message. This is only used by
+            // setState() to check wether or not we can print a connection
+            // warning (a client might close the connection forcefully if the
+            // connection isn't validated, we don't want to print a warning
+            // in this case).
+            //
+            _validated = true;
+
+            ptrdiff_t pos = _readStream.i - _readStream.b.begin();
+            if(pos < headerSize)
+            {
+                //
+                // This situation is possible for small UDP packets.
+                //
+                throw IllegalMessageSizeException(__FILE__, __LINE__);
+            }
+
+            _readStream.i = _readStream.b.begin();
+            const Byte* m;
+            _readStream.readBlob(m, static_cast<int32_t>(sizeof(magic)));
+            if(m[0] != magic[0] || m[1] != magic[1] || m[2] != magic[2] || m[3] != magic[3])
+            {
+                throw BadMagicException(__FILE__, __LINE__, "", Ice::ByteSeq(&m[0], &m[0] + sizeof(magic)));
+            }
+            ProtocolVersion pv;
+            _readStream.read(pv);
+            checkSupportedProtocol(pv);
+            EncodingVersion ev;
+            _readStream.read(ev);
+            checkSupportedProtocolEncoding(ev);
+
+            Byte messageType;
+            _readStream.read(messageType);
+            Byte compressByte;
+            _readStream.read(compressByte);
+            int32_t size;
+            _readStream.read(size);
+            if(size < headerSize)
+            {
+                throw IllegalMessageSizeException(__FILE__, __LINE__);
+            }
+
+            if(size > static_cast<int32_t>(_messageSizeMax))
+            {
+                Ex::throwMemoryLimitException(__FILE__, __LINE__, static_cast<size_t>(size), _messageSizeMax);
+            }
+            if(static_cast<size_t>(size) > _readStream.b.size())
+            {
+                _readStream.b.resize(static_cast<size_t>(size));
+            }
+            _readStream.i = _readStream.b.begin() + pos;
+        }
+
+        if(_readStream.i != _readStream.b.end())
+        {
+            if(_endpoint->datagram())
+            {
+                throw DatagramLimitException(__FILE__, __LINE__); // The message was truncated.
+            }
+            continue;
+        }
+        return readOp;
+    }
+}
+
+SocketOperation
+ConnectionI::readAhead(Buffer& buf)
+{
+    //
+    // Don't read ahead until the connection is validated, validate() reads the
+    // validation message directly from the transceiver.
+    //
+    if(_readAheadSize == 0 || _state <= StateNotValidated)
+    {
+        return read(buf);
+    }
+
+    SocketOperation op = SocketOperationNone;
+    while(buf.i != buf.b.end())
+    {
+        if(_readAheadPos == _readAheadBuffer.i)
+        {
+            //
+            // The read-ahead buffer is empty. Large messages are read directly
+            // in the message buffer, otherwise we read as much as the
+            // transceiver has to offer in the read-ahead buffer.
+            //
+            _readAheadFilled = true;
+            if(static_cast<size_t>(buf.b.end() - buf.i) >= _readAheadSize)
+            {
+                return static_cast<SocketOperation>(op | read(buf));
+            }
+
+            if(_readAheadBuffer.b.empty())
+            {
+                _readAheadBuffer.b.resize(_readAheadSize);
+            }
+            _readAheadBuffer.i = _readAheadBuffer.b.begin();
+            _readAheadPos = _readAheadBuffer.b.begin();
+
+            SocketOperation s = read(_readAheadBuffer);
+            if(_readAheadBuffer.i == _readAheadPos)
+            {
+                return static_cast<SocketOperation>(op | s);
+            }
+            op = static_cast<SocketOperation>(op | (s & ~SocketOperationRead));
+        }
+
+        size_t length = min(static_cast<size_t>(buf.b.end() - buf.i),
+                            static_cast<size_t>(_readAheadBuffer.i - _readAheadPos));
+        copy(_readAheadPos, _readAheadPos + length, buf.i);
+        buf.i += length;
+        _readAheadPos += length;
+    }
+    return op;
+}
+
+void
+ConnectionI::discardDatagram(const LocalException& ex)
+{
+    if(dynamic_cast<const DatagramLimitException*>(&ex))
+    {
+        if(_warnUdp)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "maximum datagram size of " << _readStream.i - _readStream.b.begin() << " exceeded";
+        }
+    }
+    else if(_warn)
+    {
+        Warning out(_instance->initializationData().logger);
+        out << "datagram connection exception:\n" << ex << '\n' << _desc;
+    }
+    _readStream.resize(headerSize);
+    _readStream.i = _readStream.b.begin();
+    _readHeader = true;
+}
+
+bool
+ConnectionI::hasReadAheadMessage() const
+{
+    if(_readAheadBuffer.i - _readAheadPos < headerSize)
+    {
+        return false;
+    }
+
+    int32_t size;
+    const Byte* p = _readAheadPos + 10;
+#ifdef ICE_BIG_ENDIAN
+    reverse_copy(p, p + sizeof(int32_t), reinterpret_cast<Byte*>(&size));
+#else
+    copy(p, p + sizeof(int32_t), reinterpret_cast<Byte*>(&size));
+#endif
+    return size <= _readAheadBuffer.i - _readAheadPos;
+}
+
 SocketOperation
 ConnectionI::write(Buffer& buf)
 {
@@ -3585,6 +4006,85 @@ ConnectionI::write(Buffer& buf)
     return op;
 }
 
+SocketOperation
+ConnectionI::writeSendStreams()
+{
+    //
+    // Write the message being sent together with the next queued messages, up
+    // to the write coalesce size, with a single transceiver call. Queued
+    // messages are prepared before being written, sendNextMessage notifies
+    // them once they are fully written.
+    //
+    if(_writeCoalesceSize == 0 || _sendStreams.size() < 2 || (_state != StateActive && _state != StateHolding) ||
+       _writeStream.i == _writeStream.b.end())
+    {
+        return write(_writeStream);
+    }
+
+    size_t size = static_cast<size_t>(_writeStream.b.end() - _writeStream.i);
+    _writeBuffers.clear();
+    _writeBuffers.push_back(&_writeStream);
+    for(deque<OutgoingMessage>::iterator p = _sendStreams.begin() + 1; p != _sendStreams.end(); ++p)
+    {
+        if(!p->stream->i)
+        {
+            if(size + p->stream->b.size() > _writeCoalesceSize)
+            {
+                break;
+            }
+            prepareMessage(*p);
+        }
+
+        size += static_cast<size_t>(p->stream->b.end() - p->stream->i);
+        _writeBuffers.push_back(p->stream);
+        if(size >= _writeCoalesceSize)
+        {
+            break;
+        }
+    }
+
+    if(_writeBuffers.size() == 1)
+    {
+        return write(_writeStream);
+    }
+
+    vector<Buffer::Container::iterator> start;
+    if(_observer || _instance->traceLevels()->network >= 3)
+    {
+        for(vector<Buffer*>::const_iterator p = _writeBuffers.begin(); p != _writeBuffers.end(); ++p)
+        {
+            start.push_back((*p)->i);
+        }
+    }
+
+    SocketOperation op = _transceiver->writev(_writeBuffers);
+
+    if(!start.empty())
+    {
+        size_t sent = 0;
+        for(size_t n = 0; n < _writeBuffers.size(); ++n)
+        {
+            sent += static_cast<size_t>(_writeBuffers[n]->i - start[n]);
+            if(n > 0 && _observer && _writeBuffers[n]->i != start[n])
+            {
+                //
+                // The observer only accounts for the bytes written from the write
+                // stream, report the bytes written from the next messages here.
+                //
+                _observer->sentBytes(static_cast<int>(_writeBuffers[n]->i - start[n]));
+            }
+        }
+
+        if(_instance->traceLevels()->network >= 3 && sent > 0)
+        {
+            Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+            out << "sent " << sent << " of " << size << " bytes via " << _endpoint->protocol() << " ("
+                << _writeBuffers.size() << " messages)\n" << toString();
+        }
+    }
+    return op;
+}
+
 void
 ConnectionI::reap()
 {
@@ -27,19 +27,17 @@
 #include <Ice/Dispatcher.h>
 #include <Ice/ObserverHelper.h>
 #include <Ice/BatchRequestQueueF.h>
+#include <Ice/CompressionCodecF.h>
 #include <Ice/ACM.h>
 #include <Ice/OutputStream.h>
 #include <Ice/InputStream.h>
 
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <mutex>
 #include <chrono>
 
-#ifndef ICE_HAS_BZIP2
-#   define ICE_HAS_BZIP2
-#endif
-
 namespace IceInternal
 {
 
@@ -120,6 +118,47 @@ public:
 #endif
     };
 
+    //
+    // A proxy request submitted to the lock-free send queue by sendAsyncRequest.
+    // The queue is a singly-linked list of requests, most recent first.
+    //
+    struct SendQueueRequest
+    {
+        SendQueueRequest(const IceInternal::ProxyOutgoingAsyncBasePtr& o, bool comp, bool resp, int num) :
+            outAsync(o), compress(comp), response(resp), batchRequestNum(num), next(nullptr)
+        {
+        }
+
+        IceInternal::ProxyOutgoingAsyncBasePtr outAsync;
+        bool compress;
+        bool response;
+        int batchRequestNum;
+        SendQueueRequest* next;
+    };
+
+    //
+    // A message received in the read-ahead buffer and parsed by message()
+    // after the first message. It's dispatched after the first message by
+    // the same thread.
+    //
+    struct ReadAheadMessage
+    {
+        ReadAheadMessage(IceInternal::Instance* instance) :
+            stream(instance, Ice::currentProtocolEncoding), invokeNum(0), requestId(0), compress(0)
+        {
+        }
+
+        Ice::InputStream stream;
+        std::int32_t invokeNum;
+        std::int32_t requestId;
+        Byte compress;
+        IceInternal::ServantManagerPtr servantManager;
+        ObjectAdapterPtr adapter;
+        IceInternal::OutgoingAsyncBasePtr outAsync;
+        HeartbeatCallback heartbeatCallback;
+    };
+    using ReadAheadMessagePtr = std::shared_ptr<ReadAheadMessage>;
+
     enum DestructionReason
     {
         ObjectAdapterDeactivated,
@@ -136,6 +175,7 @@ public:
 
     bool isActiveOrHolding() const;
     bool isFinished() const;
+    int getOutstandingRequestCount() const; // Returns -1 if the connection isn't active or holding.
 
     virtual void throwException() const; // From Connection. Throws the connection exception if destroyed.
 
@@ -217,7 +257,8 @@ public:
                   const ObjectAdapterPtr&,
                   const IceInternal::OutgoingAsyncBasePtr&,
                   const HeartbeatCallback&,
-                  Ice::InputStream&);
+                  Ice::InputStream&,
+                  const std::vector<ReadAheadMessagePtr>&);
     void finish(bool);
 
     void closeCallback(const CloseCallback&);
@@ -258,13 +299,14 @@ private:
 
     bool initialize(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
     bool validate(IceInternal::SocketOperation = IceInternal::SocketOperationNone);
+    IceInternal::AsyncStatus sendRequest(const IceInternal::OutgoingAsyncBasePtr&, bool, bool, int);
+    IceInternal::AsyncStatus flushSendQueue(const SendQueueRequest*);
     IceInternal::SocketOperation sendNextMessage(std::vector<OutgoingMessage>&);
     IceInternal::AsyncStatus sendMessage(OutgoingMessage&);
+    void prepareMessage(OutgoingMessage&);
 
-#ifdef ICE_HAS_BZIP2
-    void doCompress(Ice::OutputStream&, Ice::OutputStream&);
+    bool doCompress(Ice::OutputStream&, Ice::OutputStream&);
     void doUncompress(Ice::InputStream&, Ice::InputStream&);
-#endif
 
     IceInternal::SocketOperation parseMessage(Ice::InputStream&, std::int32_t&, std::int32_t&, Byte&,
                                               IceInternal::ServantManagerPtr&, ObjectAdapterPtr&,
@@ -280,7 +322,12 @@ private:
     Ice::Instrumentation::ConnectionState toConnectionState(State) const;
 
     IceInternal::SocketOperation read(IceInternal::Buffer&);
+    IceInternal::SocketOperation readMessage();
+    IceInternal::SocketOperation readAhead(IceInternal::Buffer&);
+    void discardDatagram(const Ice::LocalException&);
+    bool hasReadAheadMessage() const;
     IceInternal::SocketOperation write(IceInternal::Buffer&);
+    IceInternal::SocketOperation writeSendStreams();
 
     void reap();
 
@@ -318,6 +365,13 @@ private:
     std::chrono::steady_clock::time_point _acmLastActivity;
 
     const int _compressionLevel;
+    const IceInternal::CompressionCodecManagerPtr _compressionCodecManager;
+    IceInternal::CompressionCodecPtr _compressionCodec;
+    const size_t _compressionMinSize;
+    const bool _compressionAdaptive;
+    double _compressionRatio;
+    int _compressionSkip;
+    int _compressionBackoff;
 
     std::int32_t _nextRequestId;
 
@@ -327,13 +381,24 @@ private:
     std::exception_ptr _exception;
 
     const size_t _messageSizeMax;
+    const size_t _writeCoalesceSize;
+    const size_t _readAheadSize;
     IceInternal::BatchRequestQueuePtr _batchRequestQueue;
 
     std::deque<OutgoingMessage> _sendStreams;
 
+    const bool _sendQueueEnabled;
+    std::atomic<SendQueueRequest*> _sendQueue; // The requests waiting to be sent by the thread draining the queue.
+    std::atomic<bool> _sendQueueDraining; // True while a thread drains the send queue.
+
     Ice::InputStream _readStream;
     bool _readHeader;
+    IceInternal::Buffer _readAheadBuffer;
+    IceInternal::Buffer::Container::iterator _readAheadPos;
+    bool _readAheadReady;
+    bool _readAheadFilled;
     Ice::OutputStream _writeStream;
+    std::vector<IceInternal::Buffer*> _writeBuffers;
 
     Observer _observer;
 
@@ -43,6 +43,14 @@ Ice::WSEndpointInfo::~WSEndpointInfo()
 {
 }
 
+Ice::UNIXEndpointInfo::~UNIXEndpointInfo()
+{
+}
+
+Ice::SHMEndpointInfo::~SHMEndpointInfo()
+{
+}
+
 Ice::OpaqueEndpointInfo::~OpaqueEndpointInfo()
 {
 }
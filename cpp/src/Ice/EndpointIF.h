@@ -13,11 +13,15 @@ namespace IceInternal
 class EndpointI;
 class TcpEndpointI;
 class UdpEndpointI;
+class UnixEndpointI;
+class ShmEndpointI;
 class WSEndpoint;
 
 using EndpointIPtr = ::std::shared_ptr<EndpointI>;
 using TcpEndpointIPtr = ::std::shared_ptr<TcpEndpointI>;
 using UdpEndpointIPtr = ::std::shared_ptr<UdpEndpointI>;
+using UnixEndpointIPtr = ::std::shared_ptr<UnixEndpointI>;
+using ShmEndpointIPtr = ::std::shared_ptr<ShmEndpointI>;
 using WSEndpointPtr = ::std::shared_ptr<WSEndpoint>;
 
 }
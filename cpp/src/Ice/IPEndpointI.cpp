@@ -508,6 +508,9 @@ IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& insta
     _instance(instance),
     _protocol(instance->protocolSupport()),
     _preferIPv6(instance->preferIPv6()),
+    _ttl(max(instance->initializationData().properties->getPropertyAsIntWithDefault("Ice.DNSCache.TTL", 0), 0)),
+    _negativeTTL(max(instance->initializationData().properties->getPropertyAsIntWithDefault(
+        "Ice.DNSCache.NegativeTTL", 0), 0)),
     _destroyed(false)
 {
     updateObserver();
@@ -545,29 +548,86 @@ IceInternal::EndpointHostResolver::resolve(
         }
     }
 
-    lock_guard lock(_mutex);
-    assert(!_destroyed);
+    Key key(host, port);
+    vector<Address> addrs;
+    exception_ptr ex;
+    {
+        lock_guard lock(_mutex);
+        assert(!_destroyed);
 
-    ResolveEntry entry;
-    entry.host = host;
-    entry.port = port;
-    entry.selType = selType;
-    entry.endpoint = endpoint;
-    entry.response = std::move(response);
-    entry.exception = std::move(exception);
+        //
+        // Use the cached addresses if they haven't expired yet. If the entry is close to its expiration, a
+        // lookup is queued to refresh it. Addresses aren't cached when a network proxy is configured.
+        //
+        auto p = networkProxy ? _cache.end() : _cache.find(key);
+        if(p != _cache.end())
+        {
+            auto now = chrono::steady_clock::now();
+            if(now < p->second.expirationTime)
+            {
+                addrs = p->second.addresses;
+                ex = p->second.exception;
+                if(!ex && now >= p->second.refreshTime && _pending.find(key) == _pending.end())
+                {
+                    _pending[key];
+                    _queue.push_back(key);
+                    _conditionVariable.notify_one();
+                }
+            }
+            else
+            {
+                _cache.erase(p);
+            }
+        }
 
-    const CommunicatorObserverPtr& observer = _instance->initializationData().observer;
-    if(observer)
-    {
-        entry.observer = observer->getEndpointLookupObserver(endpoint);
-        if(entry.observer)
+        if(addrs.empty() && !ex)
         {
-            entry.observer->attach();
+            ResolveEntry entry;
+            entry.selType = selType;
+            entry.endpoint = endpoint;
+            entry.response = std::move(response);
+            entry.exception = std::move(exception);
+
+            const CommunicatorObserverPtr& observer = _instance->initializationData().observer;
+            if(observer)
+            {
+                entry.observer = observer->getEndpointLookupObserver(endpoint);
+                if(entry.observer)
+                {
+                    entry.observer->attach();
+                }
+            }
+
+            //
+            // If a lookup for the same host and port is already queued or running, wait for its result.
+            //
+            auto q = _pending.find(key);
+            if(q == _pending.end())
+            {
+                q = _pending.insert(make_pair(key, vector<ResolveEntry>())).first;
+                _queue.push_back(key);
+                _conditionVariable.notify_one();
+            }
+            q->second.push_back(std::move(entry));
+            return;
         }
     }
 
-    _queue.push_back(entry);
-    _conditionVariable.notify_one();
+    if(ex)
+    {
+        exception(ex);
+        return;
+    }
+
+    try
+    {
+        sortAddresses(addrs, _protocol, selType, _preferIPv6);
+        response(endpoint->connectors(addrs, 0));
+    }
+    catch(const Ice::LocalException&)
+    {
+        exception(current_exception());
+    }
 }
 
 void
@@ -584,7 +644,7 @@ IceInternal::EndpointHostResolver::run()
 {
     while(true)
     {
-        ResolveEntry r;
+        Key key;
         ThreadObserverPtr threadObserver;
         {
             unique_lock lock(_mutex);
@@ -595,7 +655,7 @@ IceInternal::EndpointHostResolver::run()
                 break;
             }
 
-            r = _queue.front();
+            key = _queue.front();
             _queue.pop_front();
             threadObserver = _observer.get();
         }
@@ -605,10 +665,12 @@ IceInternal::EndpointHostResolver::run()
             threadObserver->stateChanged(ThreadState::ThreadStateIdle, ThreadState::ThreadStateInUseForOther);
         }
 
+        NetworkProxyPtr networkProxy = _instance->networkProxy();
+        ProtocolSupport protocol = _protocol;
+        vector<Address> addresses;
+        exception_ptr ex;
         try
         {
-            NetworkProxyPtr networkProxy = _instance->networkProxy();
-            ProtocolSupport protocol = _protocol;
             if(networkProxy)
             {
                 networkProxy = networkProxy->resolveHost(_protocol);
@@ -618,53 +680,143 @@ IceInternal::EndpointHostResolver::run()
                 }
             }
 
-            vector<Address> addresses = getAddresses(r.host, r.port, protocol, r.selType, _preferIPv6, true);
-            if(r.observer)
+            addresses = getAddresses(key.first, key.second, protocol, Ice::EndpointSelectionType::Ordered,
+                                     _preferIPv6, true);
+        }
+        catch(const Ice::LocalException&)
+        {
+            ex = current_exception();
+        }
+
+        vector<ResolveEntry> entries;
+        {
+            lock_guard lock(_mutex);
+            auto p = _pending.find(key);
+            assert(p != _pending.end());
+            entries.swap(p->second);
+            _pending.erase(p);
+            if(!_instance->networkProxy())
             {
-                r.observer->detach();
-                r.observer = 0;
+                cache(key, addresses, ex);
             }
+        }
 
-            r.response(r.endpoint->connectors(addresses, networkProxy));
+        for(auto& r : entries)
+        {
+            try
+            {
+                if(ex)
+                {
+                    rethrow_exception(ex);
+                }
 
-            if(threadObserver)
+                vector<Address> addrs = addresses;
+                sortAddresses(addrs, protocol, r.selType, _preferIPv6);
+                if(r.observer)
+                {
+                    r.observer->detach();
+                    r.observer = 0;
+                }
+
+                r.response(r.endpoint->connectors(addrs, networkProxy));
+            }
+            catch(const Ice::LocalException& e)
             {
-                threadObserver->stateChanged(ThreadState::ThreadStateInUseForOther,
-                                             ThreadState::ThreadStateIdle);
+                if(r.observer)
+                {
+                    r.observer->failed(e.ice_id());
+                    r.observer->detach();
+                }
+                r.exception(current_exception());
             }
+        }
 
+        if(threadObserver)
+        {
+            threadObserver->stateChanged(ThreadState::ThreadStateInUseForOther, ThreadState::ThreadStateIdle);
         }
-        catch(const Ice::LocalException& ex)
+    }
+
+    for(const auto& p : _pending)
+    {
+        for(const auto& r : p.second)
         {
-            if(threadObserver)
-            {
-                threadObserver->stateChanged(ThreadState::ThreadStateInUseForOther,
-                                             ThreadState::ThreadStateIdle);
-            }
+            Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
             if(r.observer)
             {
                 r.observer->failed(ex.ice_id());
                 r.observer->detach();
             }
-            r.exception(current_exception());
+            r.exception(make_exception_ptr(ex));
         }
     }
+    _pending.clear();
+    _queue.clear();
+    _cache.clear();
 
-    for(deque<ResolveEntry>::const_iterator p = _queue.begin(); p != _queue.end(); ++p)
+    if(_observer)
     {
-        Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
-        if(p->observer)
+        _observer.detach();
+    }
+}
+
+void
+IceInternal::EndpointHostResolver::cache(const Key& key, const vector<Address>& addresses, exception_ptr ex)
+{
+    bool dnsException = false;
+    if(ex)
+    {
+        try
+        {
+            rethrow_exception(ex);
+        }
+        catch(const DNSException&)
+        {
+            dnsException = true;
+        }
+        catch(...)
         {
-            p->observer->failed(ex.ice_id());
-            p->observer->detach();
         }
-        p->exception(make_exception_ptr(ex));
     }
-    _queue.clear();
 
-    if(_observer)
+    auto now = chrono::steady_clock::now();
+    if(!ex && _ttl > chrono::seconds::zero())
     {
-        _observer.detach();
+        CacheEntry& entry = _cache[key];
+        entry.addresses = addresses;
+        entry.exception = nullptr;
+        entry.refreshTime = now + _ttl * 3 / 4;
+        entry.expirationTime = now + _ttl;
+    }
+    else if(dnsException && _negativeTTL > chrono::seconds::zero())
+    {
+        CacheEntry& entry = _cache[key];
+        entry.addresses.clear();
+        entry.exception = ex;
+        entry.refreshTime = now + _negativeTTL;
+        entry.expirationTime = now + _negativeTTL;
+    }
+    else
+    {
+        //
+        // Don't keep addresses which might no longer be valid if the refresh of a cached entry failed.
+        //
+        _cache.erase(key);
+    }
+
+    //
+    // Remove the expired entries.
+    //
+    for(auto p = _cache.begin(); p != _cache.end();)
+    {
+        if(p->second.expirationTime <= now)
+        {
+            p = _cache.erase(p);
+        }
+        else
+        {
+            ++p;
+        }
     }
 }
 
@@ -13,7 +13,9 @@
 #include <Ice/ProtocolInstanceF.h>
 #include <Ice/ObserverHelper.h>
 
+#include <chrono>
 #include <deque>
+#include <map>
 #include <mutex>
 
 namespace IceInternal
@@ -96,6 +98,12 @@ private:
     mutable std::mutex _hashMutex;
 };
 
+//
+// Resolves host names with a dedicated thread. Concurrent lookups for the same host and port are merged into a
+// single DNS query. When Ice.DNSCache.TTL is greater than 0, the addresses are cached for this number of seconds and
+// refreshed in the background when a cached entry is used during the last quarter of its lifetime. When
+// Ice.DNSCache.NegativeTTL is greater than 0, failed lookups are also cached for this number of seconds.
+//
 class ICE_API EndpointHostResolver final : public IceUtil::Thread
 {
 public:
@@ -118,8 +126,6 @@ private:
 
     struct ResolveEntry
     {
-        std::string host;
-        int port;
         Ice::EndpointSelectionType selType;
         IPEndpointIPtr endpoint;
         std::function<void(std::vector<ConnectorPtr>)> response;
@@ -127,11 +133,27 @@ private:
         Ice::Instrumentation::ObserverPtr observer;
     };
 
+    struct CacheEntry
+    {
+        std::vector<Address> addresses;
+        std::exception_ptr exception; // Set if the lookup failed.
+        std::chrono::steady_clock::time_point refreshTime;
+        std::chrono::steady_clock::time_point expirationTime;
+    };
+
+    using Key = std::pair<std::string, int>;
+
+    void cache(const Key&, const std::vector<Address>&, std::exception_ptr);
+
     const InstancePtr _instance;
     const IceInternal::ProtocolSupport _protocol;
     const bool _preferIPv6;
+    const std::chrono::seconds _ttl;
+    const std::chrono::seconds _negativeTTL;
     bool _destroyed;
-    std::deque<ResolveEntry> _queue;
+    std::deque<Key> _queue;
+    std::map<Key, std::vector<ResolveEntry>> _pending; // The requests waiting for a queued or running lookup.
+    std::map<Key, CacheEntry> _cache;
     ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
     std::mutex _mutex;
     std::condition_variable _conditionVariable;
@@ -159,6 +159,11 @@ Ice::InputStream::initialize(Instance* instance, const EncodingVersion& encoding
     _instance = instance;
     _traceSlicing = _instance->traceLevels()->slicing > 0;
     _classGraphDepthMax = _instance->classGraphDepthMax();
+
+    if(_instance->bufferPool())
+    {
+        b.setPool(_instance->bufferPool());
+    }
 }
 
 void
@@ -23,6 +23,7 @@
 #include <Ice/LoggerI.h>
 #include <Ice/NetworkProxy.h>
 #include <Ice/EndpointFactoryManager.h>
+#include <Ice/CompressionCodec.h>
 #include <Ice/IPEndpointI.h> // For EndpointHostResolver
 #include <Ice/WSEndpoint.h>
 #include <Ice/RetryQueue.h>
@@ -38,6 +39,7 @@
 #include <Ice/RegisterPluginsInit.h>
 #include <Ice/ObserverHelper.h>
 #include <Ice/ConsoleUtil.h>
+#include <Ice/BufferPool.h>
 
 #include <IceUtil/DisableWarnings.h>
 #include <IceUtil/FileUtil.h>
@@ -194,6 +196,12 @@ public:
     {
     }
 
+    Timer(int shards) :
+        IceUtil::Timer(shards),
+        _hasObserver(false)
+    {
+    }
+
     void updateObserver(const Ice::Instrumentation::CommunicatorObserverPtr&);
 
 private:
@@ -493,6 +501,20 @@ IceInternal::Instance::endpointFactoryManager() const
     return _endpointFactoryManager;
 }
 
+CompressionCodecManagerPtr
+IceInternal::Instance::compressionCodecManager() const
+{
+    lock_guard lock(_mutex);
+
+    if(_state == StateDestroyed)
+    {
+        throw CommunicatorDestroyedException(__FILE__, __LINE__);
+    }
+
+    assert(_compressionCodecManager);
+    return _compressionCodecManager;
+}
+
 DynamicLibraryListPtr
 IceInternal::Instance::dynamicLibraryList() const
 {
@@ -910,6 +932,12 @@ IceInternal::Instance::Instance(const InitializationData& initData) :
     _initData(initData),
     _messageSizeMax(0),
     _batchAutoFlushSize(0),
+    _batchAutoFlushDelay(0),
+    _batchPerThread(false),
+    _writeCoalesceSize(0),
+    _readAheadSize(0),
+    _sendQueue(false),
+    _bufferPool(0),
     _classGraphDepthMax(0),
     _toStringMode(ToStringMode::Unicode),
     _acceptClassCycles(false),
@@ -1163,6 +1191,64 @@ IceInternal::Instance::initialize(const Ice::CommunicatorPtr& communicator)
             }
         }
 
+        {
+            int32_t num = _initData.properties->getPropertyAsInt("Ice.BatchAutoFlushDelay"); // Disabled by default
+            if(num > 0)
+            {
+                const_cast<int&>(_batchAutoFlushDelay) = num; // In milliseconds.
+            }
+        }
+
+        const_cast<bool&>(_batchPerThread) = _initData.properties->getPropertyAsInt("Ice.BatchPerThread") > 0;
+
+        {
+            int32_t num = _initData.properties->getPropertyAsIntWithDefault("Ice.WriteCoalesceSize", 64); // 64KB default
+            if(num < 1)
+            {
+                const_cast<size_t&>(_writeCoalesceSize) = 0; // Disabled
+            }
+            else if(static_cast<size_t>(num) > static_cast<size_t>(0x7fffffff / 1024))
+            {
+                const_cast<size_t&>(_writeCoalesceSize) = static_cast<size_t>(0x7fffffff);
+            }
+            else
+            {
+                // Property is in kilobytes, convert in bytes.
+                const_cast<size_t&>(_writeCoalesceSize) = static_cast<size_t>(num) * 1024;
+            }
+        }
+
+        {
+            int32_t num = _initData.properties->getPropertyAsInt("Ice.ReadAheadSize"); // Disabled by default
+            if(num < 1)
+            {
+                const_cast<size_t&>(_readAheadSize) = 0; // Disabled
+            }
+            else if(static_cast<size_t>(num) > static_cast<size_t>(0x7fffffff / 1024))
+            {
+                const_cast<size_t&>(_readAheadSize) = static_cast<size_t>(0x7fffffff);
+            }
+            else
+            {
+                // Property is in kilobytes, convert in bytes.
+                const_cast<size_t&>(_readAheadSize) = static_cast<size_t>(num) * 1024;
+            }
+        }
+
+        const_cast<bool&>(_sendQueue) = _initData.properties->getPropertyAsInt("Ice.SendQueue") > 0;
+
+        if(_initData.properties->getPropertyAsInt("Ice.BufferPool") > 0)
+        {
+            // Properties are in kilobytes, convert in bytes.
+            int32_t maxBufferSize =
+                _initData.properties->getPropertyAsIntWithDefault("Ice.BufferPool.MaxBufferSize", 64); // 64KB default
+            int32_t threadCacheSize =
+                _initData.properties->getPropertyAsIntWithDefault("Ice.BufferPool.ThreadCacheSize", 64); // 64KB default
+            const_cast<BufferPool*&>(_bufferPool) =
+                BufferPool::create(static_cast<size_t>(min(max(maxBufferSize, 0), 8 * 1024)) * 1024,
+                                   static_cast<size_t>(min(max(threadCacheSize, 0), 0x7fffffff / 1024)) * 1024);
+        }
+
         {
             static const int defaultValue = 100;
             int32_t num = _initData.properties->getPropertyAsIntWithDefault("Ice.ClassGraphDepthMax", defaultValue);
@@ -1228,6 +1314,8 @@ IceInternal::Instance::initialize(const Ice::CommunicatorPtr& communicator)
 
         _endpointFactoryManager = make_shared<EndpointFactoryManager>(shared_from_this());
 
+        _compressionCodecManager = make_shared<CompressionCodecManager>(_initData.properties);
+
         _dynamicLibraryList = make_shared<DynamicLibraryList>();
 
         _pluginManager = make_shared<PluginManagerI>(communicator, _dynamicLibraryList);
@@ -1302,6 +1390,15 @@ IceInternal::Instance::~Instance()
     assert(!_dynamicLibraryList);
     assert(!_pluginManager);
 
+    if(_bufferPool)
+    {
+        //
+        // The pool is recycled by the next communicator which enables it, the
+        // buffers which outlive the communicator can still be released to it.
+        //
+        _bufferPool->destroy();
+    }
+
     lock_guard lock(staticMutex);
     if(instanceList != 0)
     {
@@ -1438,7 +1535,21 @@ IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::Com
     //
     try
     {
-        _timer = make_shared<Timer>();
+        if(_initData.properties->getPropertyAsInt("Ice.Timer.Wheel") > 0)
+        {
+            int shards = _initData.properties->getPropertyAsIntWithDefault("Ice.Timer.Shards", 1);
+            if(shards < 1)
+            {
+                Warning out(_initData.logger);
+                out << "Ice.Timer.Shards < 1; Shards adjusted to 1";
+                shards = 1;
+            }
+            _timer = make_shared<Timer>(shards);
+        }
+        else
+        {
+            _timer = make_shared<Timer>();
+        }
     }
     catch (const IceUtil::Exception& ex)
     {
@@ -1708,6 +1819,7 @@ IceInternal::Instance::destroy()
         _routerManager = nullptr;
         _locatorManager = nullptr;
         _endpointFactoryManager = nullptr;
+        _compressionCodecManager = nullptr;
         _pluginManager = nullptr;
         _dynamicLibraryList = nullptr;
 
@@ -21,6 +21,7 @@
 #include <Ice/ACM.h>
 #include <Ice/ObjectAdapterFactoryF.h>
 #include <Ice/EndpointFactoryManagerF.h>
+#include <Ice/CompressionCodecF.h>
 #include <Ice/IPEndpointIF.h>
 #include <Ice/RetryQueueF.h>
 #include <Ice/DynamicLibraryF.h>
@@ -52,6 +53,8 @@ using MetricsAdminIPtr = std::shared_ptr<MetricsAdminI>;
 class ProxyFactory;
 using ProxyFactoryPtr = std::shared_ptr<ProxyFactory>;
 
+class BufferPool;
+
 //
 // Structure to track warnings for attempts to set socket buffer sizes
 //
@@ -96,10 +99,17 @@ public:
     const std::vector<int>& retryIntervals() const { return _retryIntervals; }
     IceUtil::TimerPtr timer();
     EndpointFactoryManagerPtr endpointFactoryManager() const;
+    CompressionCodecManagerPtr compressionCodecManager() const;
     DynamicLibraryListPtr dynamicLibraryList() const;
     Ice::PluginManagerPtr pluginManager() const;
     size_t messageSizeMax() const { return _messageSizeMax; }
     size_t batchAutoFlushSize() const { return _batchAutoFlushSize; }
+    int batchAutoFlushDelay() const { return _batchAutoFlushDelay; }
+    bool batchPerThread() const { return _batchPerThread; }
+    size_t writeCoalesceSize() const { return _writeCoalesceSize; }
+    size_t readAheadSize() const { return _readAheadSize; }
+    bool sendQueue() const { return _sendQueue; }
+    BufferPool* bufferPool() const { return _bufferPool; }
     size_t classGraphDepthMax() const { return _classGraphDepthMax; }
     Ice::ToStringMode toStringMode() const { return _toStringMode; }
     bool acceptClassCycles() const { return _acceptClassCycles; }
@@ -160,6 +170,12 @@ private:
     const DefaultsAndOverridesPtr _defaultsAndOverrides; // Immutable, not reset by destroy().
     const size_t _messageSizeMax; // Immutable, not reset by destroy().
     const size_t _batchAutoFlushSize; // Immutable, not reset by destroy().
+    const int _batchAutoFlushDelay; // Immutable, not reset by destroy().
+    const bool _batchPerThread; // Immutable, not reset by destroy().
+    const size_t _writeCoalesceSize; // Immutable, not reset by destroy().
+    const size_t _readAheadSize; // Immutable, not reset by destroy().
+    const bool _sendQueue; // Immutable, not reset by destroy().
+    BufferPool* const _bufferPool; // Immutable, not reset by destroy().
     const size_t _classGraphDepthMax; // Immutable, not reset by destroy().
     const Ice::ToStringMode _toStringMode; // Immutable, not reset by destroy()
     const bool _acceptClassCycles; // Immutable, not reset by destroy()
@@ -181,6 +197,7 @@ private:
     std::vector<int> _retryIntervals;
     TimerPtr _timer;
     EndpointFactoryManagerPtr _endpointFactoryManager;
+    CompressionCodecManagerPtr _compressionCodecManager;
     DynamicLibraryListPtr _dynamicLibraryList;
     Ice::PluginManagerPtr _pluginManager;
     const Ice::ImplicitContextIPtr _implicitContext;
@@ -63,6 +63,54 @@ struct ThreadStateChanged
     ThreadState newState;
 };
 
+struct ThreadBusyPoll
+{
+    ThreadBusyPoll(int64_t spinTimeP, int64_t blockedTimeP) : spinTime(spinTimeP), blockedTime(blockedTimeP)
+    {
+    }
+
+    void operator()(const ThreadMetricsPtr& v)
+    {
+        v->spinTime += spinTime;
+        v->blockedTime += blockedTime;
+    }
+
+    int64_t spinTime;
+    int64_t blockedTime;
+};
+
+struct ThreadBufferPool
+{
+    ThreadBufferPool(int32_t hitsP, int32_t missesP) : hits(hitsP), misses(missesP)
+    {
+    }
+
+    void operator()(const ThreadMetricsPtr& v)
+    {
+        v->bufferPoolHits += hits;
+        v->bufferPoolMisses += misses;
+    }
+
+    int32_t hits;
+    int32_t misses;
+};
+
+struct ConnectionCompression
+{
+    ConnectionCompression(int32_t savedBytesP, int64_t timeP) : savedBytes(savedBytesP), time(timeP)
+    {
+    }
+
+    void operator()(const ConnectionMetricsPtr& v)
+    {
+        v->compressionSavedBytes += savedBytes;
+        v->compressionTime += time;
+    }
+
+    int32_t savedBytes;
+    int64_t time;
+};
+
 IPConnectionInfo*
 getIPConnectionInfo(const ConnectionInfoPtr& info)
 {
@@ -784,6 +832,16 @@ ConnectionObserverI::receivedBytes(int32_t num)
     }
 }
 
+void
+ConnectionObserverI::compression(int32_t savedBytes, int64_t time)
+{
+    forEach(ConnectionCompression(savedBytes, time));
+    if(_delegate)
+    {
+        _delegate->compression(savedBytes, time);
+    }
+}
+
 void
 ThreadObserverI::stateChanged(ThreadState oldState, ThreadState newState)
 {
@@ -795,6 +853,26 @@ ThreadObserverI::stateChanged(ThreadState oldState, ThreadState newState)
 
 }
 
+void
+ThreadObserverI::busyPoll(int64_t spinTime, int64_t blockedTime)
+{
+    forEach(ThreadBusyPoll(spinTime, blockedTime));
+    if(_delegate)
+    {
+        _delegate->busyPoll(spinTime, blockedTime);
+    }
+}
+
+void
+ThreadObserverI::bufferPool(int32_t hits, int32_t misses)
+{
+    forEach(ThreadBufferPool(hits, misses));
+    if(_delegate)
+    {
+        _delegate->bufferPool(hits, misses);
+    }
+}
+
 void
 DispatchObserverI::userException()
 {
@@ -153,6 +153,7 @@ public:
 
     virtual void sentBytes(std::int32_t);
     virtual void receivedBytes(std::int32_t);
+    virtual void compression(std::int32_t, std::int64_t);
 };
 
 class ThreadObserverI : public ObserverWithDelegateT<IceMX::ThreadMetrics, Ice::Instrumentation::ThreadObserver>
@@ -160,6 +161,8 @@ class ThreadObserverI : public ObserverWithDelegateT<IceMX::ThreadMetrics, Ice::
 public:
 
     virtual void stateChanged(Ice::Instrumentation::ThreadState, Ice::Instrumentation::ThreadState);
+    virtual void busyPoll(std::int64_t, std::int64_t);
+    virtual void bufferPool(std::int32_t, std::int32_t);
 };
 
 class DispatchObserverI : public ObserverWithDelegateT<IceMX::DispatchMetrics, Ice::Instrumentation::DispatchObserver>
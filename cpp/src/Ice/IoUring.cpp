@@ -0,0 +1,267 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/IoUring.h>
+
+#if defined(ICE_HAS_IO_URING)
+
+#include <Ice/LocalException.h>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include <cstring>
+
+using namespace std;
+using namespace IceInternal;
+
+namespace
+{
+
+template<typename T> T*
+ringPtr(void* ring, unsigned int offset)
+{
+    return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+
+}
+
+IceInternal::IoUring::IoUring(unsigned int entries) :
+    _sqRing(MAP_FAILED),
+    _sqRingSize(0),
+    _cqRing(MAP_FAILED),
+    _cqRingSize(0),
+    _sqes(static_cast<io_uring_sqe*>(MAP_FAILED)),
+    _sqesSize(0)
+{
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    _fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if(_fd < 0)
+    {
+        throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+
+    //
+    // We rely on the extended wait arguments to wait with a timeout without
+    // submitting a timeout request, and on the kernel never dropping
+    // completions when the completion queue overflows.
+    //
+    if(!(params.features & IORING_FEAT_EXT_ARG) || !(params.features & IORING_FEAT_NODROP))
+    {
+        ::close(_fd);
+        throw Ice::FeatureNotSupportedException(__FILE__, __LINE__, "io_uring kernel support is too old");
+    }
+
+    _sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    _cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if(params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        _sqRingSize = _cqRingSize = max(_sqRingSize, _cqRingSize);
+    }
+    _sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+    _sqRing = mmap(0, _sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_SQ_RING);
+    if(_sqRing != MAP_FAILED)
+    {
+        if(params.features & IORING_FEAT_SINGLE_MMAP)
+        {
+            _cqRing = _sqRing;
+        }
+        else
+        {
+            _cqRing = mmap(0, _cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, IORING_OFF_CQ_RING);
+        }
+    }
+    if(_cqRing != MAP_FAILED)
+    {
+        _sqes = static_cast<io_uring_sqe*>(mmap(0, _sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd,
+                                                IORING_OFF_SQES));
+    }
+    if(_sqes == MAP_FAILED)
+    {
+        int error = getSocketErrno();
+        destroy();
+        throw Ice::SocketException(__FILE__, __LINE__, error);
+    }
+
+    _sqHead = ringPtr<unsigned int>(_sqRing, params.sq_off.head);
+    _sqTail = ringPtr<unsigned int>(_sqRing, params.sq_off.tail);
+    _sqArray = ringPtr<unsigned int>(_sqRing, params.sq_off.array);
+    _sqMask = *ringPtr<unsigned int>(_sqRing, params.sq_off.ring_mask);
+    _sqEntries = params.sq_entries;
+    _sqLocalTail = *_sqTail;
+
+    _cqHead = ringPtr<unsigned int>(_cqRing, params.cq_off.head);
+    _cqTail = ringPtr<unsigned int>(_cqRing, params.cq_off.tail);
+    _cqMask = *ringPtr<unsigned int>(_cqRing, params.cq_off.ring_mask);
+    _cqes = ringPtr<io_uring_cqe>(_cqRing, params.cq_off.cqes);
+}
+
+IceInternal::IoUring::~IoUring()
+{
+    destroy();
+}
+
+void
+IceInternal::IoUring::destroy()
+{
+    if(_sqes != MAP_FAILED)
+    {
+        munmap(_sqes, _sqesSize);
+    }
+    if(_cqRing != MAP_FAILED && _cqRing != _sqRing)
+    {
+        munmap(_cqRing, _cqRingSize);
+    }
+    if(_sqRing != MAP_FAILED)
+    {
+        munmap(_sqRing, _sqRingSize);
+    }
+    ::close(_fd);
+}
+
+void
+IceInternal::IoUring::pollAdd(SOCKET fd, uint32_t events, uint64_t userData)
+{
+    io_uring_sqe* sqe = getSqe();
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+#ifdef ICE_BIG_ENDIAN
+    sqe->poll32_events = (events << 16) | (events >> 16);
+#else
+    sqe->poll32_events = events;
+#endif
+    sqe->user_data = userData;
+}
+
+void
+IceInternal::IoUring::pollRemove(uint64_t target, uint64_t userData)
+{
+    io_uring_sqe* sqe = getSqe();
+    sqe->opcode = IORING_OP_POLL_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = target;
+    sqe->user_data = userData;
+}
+
+bool
+IceInternal::IoUring::hasPending() const
+{
+    return _sqLocalTail != __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+}
+
+void
+IceInternal::IoUring::flush()
+{
+    __atomic_store_n(_sqTail, _sqLocalTail, __ATOMIC_RELEASE);
+}
+
+void
+IceInternal::IoUring::submit()
+{
+    flush();
+    unsigned int pending = _sqLocalTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+    while(pending > 0)
+    {
+        int ret = enter(pending, 0, 0, 0);
+        if(ret < 0)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+            else if(errno == EAGAIN || errno == EBUSY)
+            {
+                break; // The kernel is short on resources, the requests will be submitted with the next wait().
+            }
+            throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+        }
+        pending -= static_cast<unsigned int>(ret);
+    }
+}
+
+int
+IceInternal::IoUring::wait(int timeout)
+{
+    while(true)
+    {
+        //
+        // The submission queue tail is only published with the thread pool
+        // mutex locked (see flush()). The kernel doesn't wait for completions
+        // if it submits fewer requests than asked for so we ask for exactly the
+        // number of published requests.
+        //
+        unsigned int pending = __atomic_load_n(_sqTail, __ATOMIC_ACQUIRE) - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+        int ret = enter(pending, 1, IORING_ENTER_GETEVENTS, timeout);
+        if(ret < 0)
+        {
+            return errno == ETIME ? 0 : ret;
+        }
+        else if(static_cast<unsigned int>(ret) != pending && ready() == 0)
+        {
+            continue; // Requests were submitted concurrently by submit(), wait again.
+        }
+        return static_cast<int>(ready());
+    }
+}
+
+unsigned int
+IceInternal::IoUring::ready() const
+{
+    return __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE) - *_cqHead;
+}
+
+const io_uring_cqe&
+IceInternal::IoUring::cqe(unsigned int n) const
+{
+    return _cqes[(*_cqHead + n) & _cqMask];
+}
+
+void
+IceInternal::IoUring::consume(unsigned int n)
+{
+    __atomic_store_n(_cqHead, *_cqHead + n, __ATOMIC_RELEASE);
+}
+
+io_uring_sqe*
+IceInternal::IoUring::getSqe()
+{
+    if(_sqLocalTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE) == _sqEntries)
+    {
+        submit(); // The queue is full, submit the queued requests to make room.
+        if(_sqLocalTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE) == _sqEntries)
+        {
+            throw Ice::SocketException(__FILE__, __LINE__, EBUSY);
+        }
+    }
+
+    unsigned int index = _sqLocalTail & _sqMask;
+    io_uring_sqe* sqe = &_sqes[index];
+    memset(sqe, 0, sizeof(io_uring_sqe));
+    _sqArray[index] = index;
+    ++_sqLocalTail;
+    return sqe;
+}
+
+int
+IceInternal::IoUring::enter(unsigned int toSubmit, unsigned int minComplete, unsigned int flags, int timeout)
+{
+    if(!(flags & IORING_ENTER_GETEVENTS) || timeout < 0)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_enter, _fd, toSubmit, minComplete, flags, 0, 0));
+    }
+
+    __kernel_timespec ts;
+    ts.tv_sec = timeout / 1000;
+    ts.tv_nsec = (timeout % 1000) * 1000000;
+
+    io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    arg.ts = reinterpret_cast<uint64_t>(&ts);
+    return static_cast<int>(syscall(__NR_io_uring_enter, _fd, toSubmit, minComplete, flags | IORING_ENTER_EXT_ARG,
+                                    &arg, sizeof(arg)));
+}
+
+#endif
@@ -0,0 +1,77 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_IO_URING_H
+#define ICE_IO_URING_H
+
+#include <Ice/Network.h>
+
+#if defined(ICE_HAS_IO_URING)
+
+#include <linux/io_uring.h>
+
+namespace IceInternal
+{
+
+//
+// Thin wrapper over the io_uring system calls, used by the selector when a
+// thread pool is configured with <prefix>.IoUring=1.
+//
+// The submission queue isn't thread safe: pollAdd(), pollRemove(), flush() and
+// submit() must be called with the thread pool mutex locked. wait() submits the
+// requests published by flush() and can be called concurrently with them. The
+// completion queue is consumed with the thread pool mutex locked.
+//
+class IoUring
+{
+public:
+
+    IoUring(unsigned int);
+    ~IoUring();
+
+    void pollAdd(SOCKET, std::uint32_t, std::uint64_t);
+    void pollRemove(std::uint64_t, std::uint64_t);
+
+    bool hasPending() const;
+    void flush();
+    void submit();
+    int wait(int);
+
+    unsigned int ready() const;
+    const io_uring_cqe& cqe(unsigned int) const;
+    void consume(unsigned int);
+
+private:
+
+    void destroy();
+    io_uring_sqe* getSqe();
+    int enter(unsigned int, unsigned int, unsigned int, int);
+
+    int _fd;
+
+    void* _sqRing;
+    size_t _sqRingSize;
+    void* _cqRing;
+    size_t _cqRingSize;
+    io_uring_sqe* _sqes;
+    size_t _sqesSize;
+
+    unsigned int* _sqHead;
+    unsigned int* _sqTail;
+    unsigned int* _sqArray;
+    unsigned int _sqMask;
+    unsigned int _sqEntries;
+    unsigned int _sqLocalTail;
+
+    unsigned int* _cqHead;
+    unsigned int* _cqTail;
+    unsigned int _cqMask;
+    io_uring_cqe* _cqes;
+};
+
+}
+
+#endif
+
+#endif
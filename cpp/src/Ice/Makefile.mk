@@ -14,6 +14,21 @@ endif
 
 Ice_sliceflags          := --include-dir Ice
 Ice_libs                := bz2
+
+ifeq ($(shell pkg-config --exists liblz4 2> /dev/null && echo yes),yes)
+Ice_cppflags            += -DICE_HAS_LZ4 $(shell pkg-config --cflags liblz4)
+Ice_ldflags             += $(shell pkg-config --libs liblz4)
+endif
+
+ifeq ($(shell pkg-config --exists libzstd 2> /dev/null && echo yes),yes)
+Ice_cppflags            += -DICE_HAS_ZSTD $(shell pkg-config --cflags libzstd)
+Ice_ldflags             += $(shell pkg-config --libs libzstd)
+endif
+
+ifeq ($(shell pkg-config --exists zlib 2> /dev/null && echo yes),yes)
+Ice_cppflags            += -DICE_HAS_ZLIB $(shell pkg-config --cflags zlib)
+Ice_ldflags             += $(shell pkg-config --libs zlib)
+endif
 Ice_extra_sources       := $(wildcard src/IceUtil/*.cpp)
 Ice_excludes            = src/Ice/DLLMain.cpp
 
@@ -83,35 +83,6 @@ public:
     }
 };
 
-void
-sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType, bool preferIPv6)
-{
-    if(selType == Ice::EndpointSelectionType::Random)
-    {
-        IceUtilInternal::shuffle(addrs.begin(), addrs.end());
-    }
-
-    if(protocol == EnableBoth)
-    {
-        if(preferIPv6)
-        {
-            stable_partition(addrs.begin(), addrs.end(),
-                             [](const Address& ss)
-                             {
-                                 return ss.saStorage.ss_family == AF_INET6;
-                             });
-        }
-        else
-        {
-            stable_partition(addrs.begin(), addrs.end(),
-                             [](const Address& ss)
-                             {
-                                 return ss.saStorage.ss_family != AF_INET6;
-                             });
-        }
-    }
-}
-
 void
 setTcpNoDelay(SOCKET fd)
 {
@@ -142,6 +113,12 @@ createSocketImpl(bool udp, int family)
     {
         fd = socket(family, SOCK_DGRAM, IPPROTO_UDP);
     }
+#ifndef _WIN32
+    else if(family == AF_UNIX)
+    {
+        fd = socket(family, SOCK_STREAM, 0);
+    }
+#endif
     else
     {
         fd = socket(family, SOCK_STREAM, IPPROTO_TCP);
@@ -152,7 +129,11 @@ createSocketImpl(bool udp, int family)
         throw SocketException(__FILE__, __LINE__, getSocketErrno());
     }
 
+#ifndef _WIN32
+    if(!udp && family != AF_UNIX)
+#else
     if(!udp)
+#endif
     {
         setTcpNoDelay(fd);
         setKeepAlive(fd);
@@ -703,6 +684,12 @@ getAddressStorageSize(const Address& addr)
     {
         size = sizeof(sockaddr_in6);
     }
+#ifndef _WIN32
+    else if(addr.saStorage.ss_family == AF_UNIX)
+    {
+        size = sizeof(sockaddr_un);
+    }
+#endif
     return size;
 }
 
@@ -923,6 +910,36 @@ IceInternal::getAddresses(const string& host, int port, ProtocolSupport protocol
     return result;
 }
 
+void
+IceInternal::sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType,
+                           bool preferIPv6)
+{
+    if(selType == Ice::EndpointSelectionType::Random)
+    {
+        IceUtilInternal::shuffle(addrs.begin(), addrs.end());
+    }
+
+    if(protocol == EnableBoth)
+    {
+        if(preferIPv6)
+        {
+            stable_partition(addrs.begin(), addrs.end(),
+                             [](const Address& ss)
+                             {
+                                 return ss.saStorage.ss_family == AF_INET6;
+                             });
+        }
+        else
+        {
+            stable_partition(addrs.begin(), addrs.end(),
+                             [](const Address& ss)
+                             {
+                                 return ss.saStorage.ss_family != AF_INET6;
+                             });
+        }
+    }
+}
+
 ProtocolSupport
 IceInternal::getProtocolSupport(const Address& addr)
 {
@@ -991,6 +1008,20 @@ IceInternal::compareAddress(const Address& addr1, const Address& addr2)
             return 1;
         }
     }
+#ifndef _WIN32
+    else if(addr1.saStorage.ss_family == AF_UNIX)
+    {
+        int res = strncmp(addr1.saUn.sun_path, addr2.saUn.sun_path, sizeof(addr1.saUn.sun_path));
+        if(res < 0)
+        {
+            return -1;
+        }
+        else if(res > 0)
+        {
+            return 1;
+        }
+    }
+#endif
     else
     {
         if(addr1.saIn6.sin6_port < addr2.saIn6.sin6_port)
@@ -1105,6 +1136,12 @@ IceInternal::closeSocket(SOCKET fd)
 string
 IceInternal::addrToString(const Address& addr)
 {
+#ifndef _WIN32
+    if(addr.saStorage.ss_family == AF_UNIX)
+    {
+        return inetAddrToString(addr);
+    }
+#endif
     ostringstream s;
     s << inetAddrToString(addr) << ':' << getPort(addr);
     return s.str();
@@ -1324,6 +1361,18 @@ IceInternal::inetAddrToString(const Address& ss)
         return "";
     }
 
+#ifndef _WIN32
+    //
+    // The address of a Unix domain socket is its path, the socket of a
+    // client is usually not bound and has no path.
+    //
+    if(ss.saStorage.ss_family == AF_UNIX)
+    {
+        size_t len = strnlen(ss.saUn.sun_path, sizeof(ss.saUn.sun_path));
+        return len == 0 ? string("<unnamed>") : string(ss.saUn.sun_path, len);
+    }
+#endif
+
     char namebuf[1024];
     namebuf[0] = '\0';
     getnameinfo(&ss.sa, static_cast<socklen_t>(size), namebuf, static_cast<socklen_t>(sizeof(namebuf)), 0, 0,
@@ -1666,6 +1715,19 @@ IceInternal::getNumericAddress(const std::string& address)
     }
 }
 
+#ifndef _WIN32
+Address
+IceInternal::getUnixAddress(const string& path)
+{
+    Address addr;
+    memset(&addr.saStorage, 0, sizeof(sockaddr_storage));
+    assert(path.size() < sizeof(addr.saUn.sun_path));
+    addr.saUn.sun_family = AF_UNIX;
+    memcpy(addr.saUn.sun_path, path.c_str(), path.size());
+    return addr;
+}
+#endif
+
 int
 IceInternal::getSocketErrno()
 {
@@ -1965,8 +2027,12 @@ IceInternal::doFinishConnect(SOCKET fd)
 #endif
 }
 
+//
+// The accepted socket is configured with the TCP options unless tcp is false,
+// which is the case for Unix domain sockets.
+//
 SOCKET
-IceInternal::doAccept(SOCKET fd)
+IceInternal::doAccept(SOCKET fd, bool tcp)
 {
 #ifdef _WIN32
     SOCKET ret;
@@ -1985,8 +2051,11 @@ repeatAccept:
         throw SocketException(__FILE__, __LINE__, getSocketErrno());
     }
 
-    setTcpNoDelay(ret);
-    setKeepAlive(ret);
+    if(tcp)
+    {
+        setTcpNoDelay(ret);
+        setKeepAlive(ret);
+    }
     return ret;
 }
 
@@ -27,6 +27,7 @@ typedef int ssize_t;
 #   include <unistd.h>
 #   include <fcntl.h>
 #   include <sys/socket.h>
+#   include <sys/un.h>
 #   include <sys/poll.h>
 #   include <netinet/in.h>
 #   include <netinet/tcp.h>
@@ -50,6 +51,14 @@ typedef int ssize_t;
 #   define ICE_USE_POLL 1
 #endif
 
+#if defined(ICE_USE_EPOLL) && !defined(ICE_NO_IO_URING) && __has_include(<linux/io_uring.h>)
+#   define ICE_HAS_IO_URING 1
+#endif
+
+#if defined(__linux__) && !defined(ICE_NO_MMSG)
+#   define ICE_HAS_MMSG 1
+#endif
+
 #if defined(_WIN32) || defined(__osf__)
 typedef int socklen_t;
 #endif
@@ -94,6 +103,9 @@ union Address
     sockaddr sa;
     sockaddr_in saIn;
     sockaddr_in6 saIn6;
+#ifndef _WIN32
+    sockaddr_un saUn;
+#endif
     sockaddr_storage saStorage;
 };
 
@@ -194,6 +206,7 @@ ICE_API bool noMoreFds(int);
 ICE_API std::string errorToStringDNS(int);
 ICE_API std::vector<Address> getAddresses(const std::string&, int, ProtocolSupport, Ice::EndpointSelectionType, bool,
                                           bool);
+ICE_API void sortAddresses(std::vector<Address>&, ProtocolSupport, Ice::EndpointSelectionType, bool);
 ICE_API ProtocolSupport getProtocolSupport(const Address&);
 ICE_API Address getAddressForServer(const std::string&, int, ProtocolSupport, bool, bool);
 ICE_API int compareAddress(const Address&, const Address&);
@@ -252,13 +265,16 @@ ICE_API bool connectionLost();
 
 ICE_API bool doConnect(SOCKET, const Address&, const Address&);
 ICE_API void doFinishConnect(SOCKET);
-ICE_API SOCKET doAccept(SOCKET);
+ICE_API SOCKET doAccept(SOCKET, bool = true);
 
 ICE_API void createPipe(SOCKET fds[2]);
 
 ICE_API int getSocketErrno();
 
 ICE_API Address getNumericAddress(const std::string&);
+#ifndef _WIN32
+ICE_API Address getUnixAddress(const std::string&);
+#endif
 
 #if defined(ICE_USE_IOCP)
 ICE_API void doConnectAsync(SOCKET, const Address&, const Address&, AsyncInfo&);
@@ -422,7 +422,7 @@ ProxyOutgoingAsyncBase::cancelable(const CancellationHandlerPtr& handler)
 void
 ProxyOutgoingAsyncBase::retryException()
 {
-    // retryException is only called by ConnectRequestHandler!
+    // retryException is only called by ConnectRequestHandler and by the connection send queue!
 
     try
     {
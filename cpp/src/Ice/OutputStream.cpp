@@ -130,6 +130,11 @@ Ice::OutputStream::initialize(Instance* instance, const EncodingVersion& encodin
     _encoding = encoding;
 
     _format = _instance->defaultsAndOverrides()->defaultFormat;
+
+    if(_instance->bufferPool())
+    {
+        b.setPool(_instance->bufferPool());
+    }
 }
 
 void
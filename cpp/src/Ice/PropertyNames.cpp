@@ -1,7 +1,7 @@
 //
 // Copyright (c) ZeroC, Inc. All rights reserved.
 //
-// Generated by makeprops.py from file ..\config\PropertyNames.xml, Tue Dec 19 17:44:30 2023
+// Generated by makeprops.py from file ..\config\PropertyNames.xml, Sat Oct 17 07:49:59 UTC 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -35,6 +35,8 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Locator.PreferSecure", false, 0),
     IceInternal::Property("Ice.Admin.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Admin.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Ice.Admin.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Ice.Admin.Locator.Locator", false, 0),
     IceInternal::Property("Ice.Admin.Locator.Router", false, 0),
     IceInternal::Property("Ice.Admin.Locator.CollocationOptimized", false, 0),
@@ -47,6 +49,8 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.Router.PreferSecure", false, 0),
     IceInternal::Property("Ice.Admin.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Admin.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Admin.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Ice.Admin.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Ice.Admin.Router.Locator", false, 0),
     IceInternal::Property("Ice.Admin.Router.Router", false, 0),
     IceInternal::Property("Ice.Admin.Router.CollocationOptimized", false, 0),
@@ -58,6 +62,13 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.StackSize", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("Ice.Admin.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("Ice.Admin.MessageSizeMax", false, 0),
@@ -71,12 +82,22 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ServerId", false, 0),
     IceInternal::Property("Ice.BackgroundLocatorCacheUpdates", false, 0),
     IceInternal::Property("Ice.BatchAutoFlush", true, 0),
+    IceInternal::Property("Ice.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Ice.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Ice.BatchPerThread", false, 0),
+    IceInternal::Property("Ice.BufferPool", false, 0),
+    IceInternal::Property("Ice.BufferPool.MaxBufferSize", false, 0),
+    IceInternal::Property("Ice.BufferPool.ThreadCacheSize", false, 0),
     IceInternal::Property("Ice.ChangeUser", false, 0),
     IceInternal::Property("Ice.ClassGraphDepthMax", false, 0),
     IceInternal::Property("Ice.ClientAccessPolicyProtocol", false, 0),
+    IceInternal::Property("Ice.Compression.Adaptive", false, 0),
+    IceInternal::Property("Ice.Compression.Codecs", false, 0),
     IceInternal::Property("Ice.Compression.Level", false, 0),
+    IceInternal::Property("Ice.Compression.MinSize", false, 0),
     IceInternal::Property("Ice.Config", false, 0),
+    IceInternal::Property("Ice.ConnectionAttemptDelay", false, 0),
+    IceInternal::Property("Ice.ConnectionPoolSize", false, 0),
     IceInternal::Property("Ice.ConsoleListener", false, 0),
     IceInternal::Property("Ice.Default.CollocationOptimized", false, 0),
     IceInternal::Property("Ice.Default.EncodingVersion", false, 0),
@@ -87,6 +108,8 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.Locator.PreferSecure", false, 0),
     IceInternal::Property("Ice.Default.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Default.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Default.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Ice.Default.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Ice.Default.Locator.Locator", false, 0),
     IceInternal::Property("Ice.Default.Locator.Router", false, 0),
     IceInternal::Property("Ice.Default.Locator.CollocationOptimized", false, 0),
@@ -102,6 +125,8 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.Router.PreferSecure", false, 0),
     IceInternal::Property("Ice.Default.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Ice.Default.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Ice.Default.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Ice.Default.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Ice.Default.Router.Locator", false, 0),
     IceInternal::Property("Ice.Default.Router.Router", false, 0),
     IceInternal::Property("Ice.Default.Router.CollocationOptimized", false, 0),
@@ -110,6 +135,8 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.SlicedFormat", false, 0),
     IceInternal::Property("Ice.Default.SourceAddress", false, 0),
     IceInternal::Property("Ice.Default.Timeout", false, 0),
+    IceInternal::Property("Ice.DNSCache.NegativeTTL", false, 0),
+    IceInternal::Property("Ice.DNSCache.TTL", false, 0),
     IceInternal::Property("Ice.EventLog.Source", false, 0),
     IceInternal::Property("Ice.FactoryAssemblies", false, 0),
     IceInternal::Property("Ice.HTTPProxyHost", false, 0),
@@ -138,8 +165,12 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.PrintProcessId", false, 0),
     IceInternal::Property("Ice.PrintStackTraces", false, 0),
     IceInternal::Property("Ice.ProgramName", false, 0),
+    IceInternal::Property("Ice.ReadAheadSize", false, 0),
     IceInternal::Property("Ice.RetryIntervals", false, 0),
+    IceInternal::Property("Ice.SendQueue", false, 0),
     IceInternal::Property("Ice.ServerIdleTime", false, 0),
+    IceInternal::Property("Ice.SHM.RingSize", false, 0),
+    IceInternal::Property("Ice.SHM.SpinTime", false, 0),
     IceInternal::Property("Ice.SOCKSProxyHost", false, 0),
     IceInternal::Property("Ice.SOCKSProxyPort", false, 0),
     IceInternal::Property("Ice.StdErr", false, 0),
@@ -150,6 +181,13 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Client.SizeWarn", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.StackSize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.Serialize", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.IoUring", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.WorkStealing", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.BusyPoll", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.BusyPollThreads", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.CpuAffinity", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.NumaNode", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Client.PinThreads", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Client.ThreadPriority", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.Size", false, 0),
@@ -157,9 +195,18 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.ThreadPool.Server.SizeWarn", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.StackSize", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.Serialize", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.IoUring", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.WorkStealing", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.BusyPoll", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.BusyPollThreads", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.CpuAffinity", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.NumaNode", false, 0),
+    IceInternal::Property("Ice.ThreadPool.Server.PinThreads", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.ThreadPool.Server.ThreadPriority", false, 0),
     IceInternal::Property("Ice.ThreadPriority", false, 0),
+    IceInternal::Property("Ice.Timer.Shards", false, 0),
+    IceInternal::Property("Ice.Timer.Wheel", false, 0),
     IceInternal::Property("Ice.ToStringMode", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Properties", false, 0),
     IceInternal::Property("Ice.Trace.Admin.Logger", false, 0),
@@ -169,6 +216,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Trace.Retry", false, 0),
     IceInternal::Property("Ice.Trace.Slicing", false, 0),
     IceInternal::Property("Ice.Trace.ThreadPool", false, 0),
+    IceInternal::Property("Ice.UDP.BatchSize", false, 0),
     IceInternal::Property("Ice.UDP.RcvSize", false, 0),
     IceInternal::Property("Ice.UDP.SndSize", false, 0),
     IceInternal::Property("Ice.TCP.Backlog", false, 0),
@@ -178,6 +226,12 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.UseOSLog", false, 0),
     IceInternal::Property("Ice.UseSyslog", false, 0),
     IceInternal::Property("Ice.UseSystemdJournal", false, 0),
+    IceInternal::Property("Ice.WS.Deflate", false, 0),
+    IceInternal::Property("Ice.WS.Deflate.ClientMaxWindowBits", false, 0),
+    IceInternal::Property("Ice.WS.Deflate.ClientNoContextTakeover", false, 0),
+    IceInternal::Property("Ice.WS.Deflate.MinSize", false, 0),
+    IceInternal::Property("Ice.WS.Deflate.ServerMaxWindowBits", false, 0),
+    IceInternal::Property("Ice.WS.Deflate.ServerNoContextTakeover", false, 0),
     IceInternal::Property("Ice.Warn.AMICallback", false, 0),
     IceInternal::Property("Ice.Warn.Connections", false, 0),
     IceInternal::Property("Ice.Warn.Datagrams", false, 0),
@@ -185,6 +239,7 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Warn.Endpoints", false, 0),
     IceInternal::Property("Ice.Warn.UnknownProperties", false, 0),
     IceInternal::Property("Ice.Warn.UnusedProperties", false, 0),
+    IceInternal::Property("Ice.WriteCoalesceSize", false, 0),
     IceInternal::Property("Ice.CacheMessageBuffers", false, 0),
     IceInternal::Property("Ice.ThreadInterruptSafe", false, 0),
 };
@@ -220,6 +275,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.Router", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Locator.CollocationOptimized", false, 0),
@@ -232,6 +289,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.Router", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.Router.CollocationOptimized", false, 0),
@@ -243,6 +302,13 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.MessageSizeMax", false, 0),
@@ -257,6 +323,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.Router", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Locator.CollocationOptimized", false, 0),
@@ -269,6 +337,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.Router", false, 0),
     IceInternal::Property("IceDiscovery.Reply.Router.CollocationOptimized", false, 0),
@@ -280,6 +350,13 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceDiscovery.Reply.MessageSizeMax", false, 0),
@@ -294,6 +371,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.Router", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Locator.CollocationOptimized", false, 0),
@@ -306,6 +385,8 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.Router.PreferSecure", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.Locator", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.Router", false, 0),
     IceInternal::Property("IceDiscovery.Locator.Router.CollocationOptimized", false, 0),
@@ -317,6 +398,13 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceDiscovery.Locator.MessageSizeMax", false, 0),
@@ -347,6 +435,8 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.Locator", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Locator.CollocationOptimized", false, 0),
@@ -359,6 +449,8 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.Locator", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.Router.CollocationOptimized", false, 0),
@@ -370,6 +462,13 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Reply.MessageSizeMax", false, 0),
@@ -384,6 +483,8 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.Locator", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Locator.CollocationOptimized", false, 0),
@@ -396,6 +497,8 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.PreferSecure", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.Locator", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.Router", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.Router.CollocationOptimized", false, 0),
@@ -407,6 +510,13 @@ const IceInternal::Property IceLocatorDiscoveryPropsData[] =
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceLocatorDiscovery.Locator.MessageSizeMax", false, 0),
@@ -457,6 +567,8 @@ const IceInternal::Property IceBoxAdminPropsData[] =
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.PreferSecure", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.InvocationTimeout", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.Locator", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.Router", false, 0),
     IceInternal::Property("IceBoxAdmin.ServiceManager.Proxy.CollocationOptimized", false, 0),
@@ -481,6 +593,8 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceBridge.Source.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceBridge.Source.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.Locator", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.Router", false, 0),
     IceInternal::Property("IceBridge.Source.Locator.CollocationOptimized", false, 0),
@@ -493,6 +607,8 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.Router.PreferSecure", false, 0),
     IceInternal::Property("IceBridge.Source.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceBridge.Source.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceBridge.Source.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceBridge.Source.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceBridge.Source.Router.Locator", false, 0),
     IceInternal::Property("IceBridge.Source.Router.Router", false, 0),
     IceInternal::Property("IceBridge.Source.Router.CollocationOptimized", false, 0),
@@ -504,6 +620,13 @@ const IceInternal::Property IceBridgePropsData[] =
     IceInternal::Property("IceBridge.Source.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceBridge.Source.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceBridge.Source.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceBridge.Source.MessageSizeMax", false, 0),
@@ -536,6 +659,8 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Server.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Locator.CollocationOptimized", false, 0),
@@ -548,6 +673,8 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Server.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Server.Router.CollocationOptimized", false, 0),
@@ -559,6 +686,13 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceGridAdmin.Server.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Server.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGridAdmin.Server.MessageSizeMax", false, 0),
@@ -576,6 +710,8 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Locator.CollocationOptimized", false, 0),
@@ -588,6 +724,8 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.Router.CollocationOptimized", false, 0),
@@ -599,6 +737,13 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.MessageSizeMax", false, 0),
@@ -613,6 +758,8 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Locator.CollocationOptimized", false, 0),
@@ -625,6 +772,8 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.Locator", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.Router", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.Router.CollocationOptimized", false, 0),
@@ -636,6 +785,13 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Locator.MessageSizeMax", false, 0),
@@ -660,6 +816,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Locator.CollocationOptimized", false, 0),
@@ -672,6 +830,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.Router", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.Router.CollocationOptimized", false, 0),
@@ -683,6 +843,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.MessageSizeMax", false, 0),
@@ -698,6 +865,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Node.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Node.Locator.CollocationOptimized", false, 0),
@@ -710,6 +879,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Node.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Node.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Node.Router.CollocationOptimized", false, 0),
@@ -721,6 +892,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceGrid.Node.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Node.MessageSizeMax", false, 0),
@@ -747,6 +925,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.UserAccountMapper.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Node.UserAccountMapper.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.Locator", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.Router", false, 0),
     IceInternal::Property("IceGrid.Node.UserAccountMapper.CollocationOptimized", false, 0),
@@ -759,6 +939,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminPermissionsVerifier.CollocationOptimized", false, 0),
@@ -776,6 +958,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Locator.CollocationOptimized", false, 0),
@@ -788,6 +972,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.Router.CollocationOptimized", false, 0),
@@ -799,6 +985,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.MessageSizeMax", false, 0),
@@ -807,6 +1000,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.CollocationOptimized", false, 0),
@@ -823,6 +1018,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Locator.CollocationOptimized", false, 0),
@@ -835,6 +1032,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.Router.CollocationOptimized", false, 0),
@@ -846,6 +1045,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.MessageSizeMax", false, 0),
@@ -862,6 +1068,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Locator.CollocationOptimized", false, 0),
@@ -874,6 +1082,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Router.CollocationOptimized", false, 0),
@@ -885,6 +1095,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.MessageSizeMax", false, 0),
@@ -904,6 +1121,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Locator.CollocationOptimized", false, 0),
@@ -916,6 +1135,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.Router.CollocationOptimized", false, 0),
@@ -927,6 +1148,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.MessageSizeMax", false, 0),
@@ -938,6 +1166,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.PermissionsVerifier.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.CollocationOptimized", false, 0),
@@ -958,6 +1188,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Locator.CollocationOptimized", false, 0),
@@ -970,6 +1202,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.Router.CollocationOptimized", false, 0),
@@ -981,6 +1215,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.MessageSizeMax", false, 0),
@@ -996,6 +1237,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Locator.CollocationOptimized", false, 0),
@@ -1008,6 +1251,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.Router.CollocationOptimized", false, 0),
@@ -1019,6 +1264,13 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.MessageSizeMax", false, 0),
@@ -1028,6 +1280,8 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.CollocationOptimized", false, 0),
@@ -1067,6 +1321,8 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.Locator.PreferSecure", false, 0),
     IceInternal::Property("IcePatch2.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IcePatch2.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("IcePatch2.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IcePatch2.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IcePatch2.Locator.Locator", false, 0),
     IceInternal::Property("IcePatch2.Locator.Router", false, 0),
     IceInternal::Property("IcePatch2.Locator.CollocationOptimized", false, 0),
@@ -1079,6 +1335,8 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.Router.PreferSecure", false, 0),
     IceInternal::Property("IcePatch2.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("IcePatch2.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("IcePatch2.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("IcePatch2.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("IcePatch2.Router.Locator", false, 0),
     IceInternal::Property("IcePatch2.Router.Router", false, 0),
     IceInternal::Property("IcePatch2.Router.CollocationOptimized", false, 0),
@@ -1090,6 +1348,13 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.StackSize", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("IcePatch2.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IcePatch2.MessageSizeMax", false, 0),
@@ -1135,6 +1400,7 @@ const IceInternal::Property IceSSLPropsData[] =
     IceInternal::Property("IceSSL.FindCert", false, 0),
     IceInternal::Property("IceSSL.FindCert.*", true, 0),
     IceInternal::Property("IceSSL.InitOpenSSL", false, 0),
+    IceInternal::Property("IceSSL.KernelTLS", false, 0),
     IceInternal::Property("IceSSL.KeyFile", false, 0),
     IceInternal::Property("IceSSL.Keychain", false, 0),
     IceInternal::Property("IceSSL.KeychainPassword", false, 0),
@@ -1151,6 +1417,10 @@ const IceInternal::Property IceSSLPropsData[] =
     IceInternal::Property("IceSSL.RevocationCheck", false, 0),
     IceInternal::Property("IceSSL.RevocationCheckCacheOnly", false, 0),
     IceInternal::Property("IceSSL.SchannelStrongCrypto", false, 0),
+    IceInternal::Property("IceSSL.SessionCacheSize", false, 0),
+    IceInternal::Property("IceSSL.SessionReuse", false, 0),
+    IceInternal::Property("IceSSL.SessionTickets", false, 0),
+    IceInternal::Property("IceSSL.SessionTimeout", false, 0),
     IceInternal::Property("IceSSL.Trace.Security", false, 0),
     IceInternal::Property("IceSSL.TrustOnly", false, 0),
     IceInternal::Property("IceSSL.TrustOnly.Client", false, 0),
@@ -1203,6 +1473,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.Locator.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Glacier2.Client.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.Locator", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.Router", false, 0),
     IceInternal::Property("Glacier2.Client.Locator.CollocationOptimized", false, 0),
@@ -1215,6 +1487,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.Router.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Client.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Client.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Glacier2.Client.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Glacier2.Client.Router.Locator", false, 0),
     IceInternal::Property("Glacier2.Client.Router.Router", false, 0),
     IceInternal::Property("Glacier2.Client.Router.CollocationOptimized", false, 0),
@@ -1226,6 +1500,13 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.StackSize", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("Glacier2.Client.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("Glacier2.Client.MessageSizeMax", false, 0),
@@ -1249,6 +1530,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.PermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Glacier2.PermissionsVerifier.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.Locator", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.Router", false, 0),
     IceInternal::Property("Glacier2.PermissionsVerifier.CollocationOptimized", false, 0),
@@ -1260,6 +1543,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Glacier2.SSLPermissionsVerifier.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.Locator", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.Router", false, 0),
     IceInternal::Property("Glacier2.SSLPermissionsVerifier.CollocationOptimized", false, 0),
@@ -1277,6 +1562,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.Locator.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Glacier2.Server.Locator.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.Locator", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.Router", false, 0),
     IceInternal::Property("Glacier2.Server.Locator.CollocationOptimized", false, 0),
@@ -1289,6 +1576,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.Router.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.Server.Router.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.Server.Router.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Glacier2.Server.Router.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Glacier2.Server.Router.Locator", false, 0),
     IceInternal::Property("Glacier2.Server.Router.Router", false, 0),
     IceInternal::Property("Glacier2.Server.Router.CollocationOptimized", false, 0),
@@ -1300,6 +1589,13 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ThreadPool.SizeWarn", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.StackSize", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.Serialize", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.IoUring", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.WorkStealing", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.BusyPoll", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.BusyPollThreads", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.CpuAffinity", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.NumaNode", false, 0),
+    IceInternal::Property("Glacier2.Server.ThreadPool.PinThreads", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("Glacier2.Server.MessageSizeMax", false, 0),
@@ -1313,6 +1609,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SessionManager.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SessionManager.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SessionManager.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Glacier2.SessionManager.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Glacier2.SessionManager.Locator", false, 0),
     IceInternal::Property("Glacier2.SessionManager.Router", false, 0),
     IceInternal::Property("Glacier2.SessionManager.CollocationOptimized", false, 0),
@@ -1323,6 +1621,8 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.SSLSessionManager.PreferSecure", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.LocatorCacheTimeout", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.InvocationTimeout", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.BatchAutoFlushSize", false, 0),
+    IceInternal::Property("Glacier2.SSLSessionManager.BatchAutoFlushDelay", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.Locator", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.Router", false, 0),
     IceInternal::Property("Glacier2.SSLSessionManager.CollocationOptimized", false, 0),
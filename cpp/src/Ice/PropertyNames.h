@@ -1,7 +1,7 @@
 //
 // Copyright (c) ZeroC, Inc. All rights reserved.
 //
-// Generated by makeprops.py from file ..\config\PropertyNames.xml, Tue Dec 19 17:44:30 2023
+// Generated by makeprops.py from file ..\config\PropertyNames.xml, Sat Oct 17 07:49:59 UTC 2026
 
 // IMPORTANT: Do not edit this file -- any edits made here will be lost!
 
@@ -5,6 +5,7 @@
 #include <Ice/ProtocolPluginFacade.h>
 #include <Ice/Instance.h>
 #include <Ice/EndpointFactoryManager.h>
+#include <Ice/CompressionCodec.h>
 #include <Ice/TraceLevels.h>
 #include <Ice/Initialize.h>
 #include <Ice/DefaultsAndOverrides.h>
@@ -42,6 +43,12 @@ IceInternal::ProtocolPluginFacade::getEndpointFactory(Ice::Short type) const
     return _instance->endpointFactoryManager()->get(type);
 }
 
+void
+IceInternal::ProtocolPluginFacade::addCompressionCodec(const CompressionCodecPtr& codec) const
+{
+    _instance->compressionCodecManager()->add(codec);
+}
+
 IceInternal::ProtocolPluginFacade::ProtocolPluginFacade(const CommunicatorPtr& communicator) :
     _instance(getInstance(communicator)),
     _communicator(communicator)
@@ -9,6 +9,7 @@
 #include <Ice/ProtocolPluginFacadeF.h>
 #include <Ice/CommunicatorF.h>
 #include <Ice/EndpointFactoryF.h>
+#include <Ice/CompressionCodecF.h>
 #include <Ice/InstanceF.h>
 #include <Ice/EndpointIF.h>
 #include <Ice/NetworkF.h>
@@ -49,6 +50,11 @@ public:
     //
     EndpointFactoryPtr getEndpointFactory(Ice::Short) const;
 
+    //
+    // Register a CompressionCodec.
+    //
+    void addCompressionCodec(const CompressionCodecPtr&) const;
+
 private:
 
     friend ICE_API ProtocolPluginFacadePtr getProtocolPluginFacade(const Ice::CommunicatorPtr&);
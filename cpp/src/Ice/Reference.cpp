@@ -821,7 +821,9 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
                                                   EndpointSelectionType endpointSelection,
                                                   int locatorCacheTimeout,
                                                   int invocationTimeout,
-                                                  const Ice::Context& ctx) :
+                                                  const Ice::Context& ctx,
+                                                  size_t batchAutoFlushSize,
+                                                  int batchAutoFlushDelay) :
     Reference(instance, communicator, id, facet, mode, secure, protocol, encoding, invocationTimeout, ctx),
     _endpoints(endpoints),
     _adapterId(adapterId),
@@ -832,6 +834,8 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
     _preferSecure(preferSecure),
     _endpointSelection(endpointSelection),
     _locatorCacheTimeout(locatorCacheTimeout),
+    _batchAutoFlushSize(batchAutoFlushSize),
+    _batchAutoFlushDelay(batchAutoFlushDelay),
     _overrideTimeout(false),
     _timeout(-1)
 {
@@ -1716,6 +1720,8 @@ IceInternal::RoutableReference::RoutableReference(const RoutableReference& r) :
     _preferSecure(r._preferSecure),
     _endpointSelection(r._endpointSelection),
     _locatorCacheTimeout(r._locatorCacheTimeout),
+    _batchAutoFlushSize(r._batchAutoFlushSize),
+    _batchAutoFlushDelay(r._batchAutoFlushDelay),
     _overrideTimeout(r._overrideTimeout),
     _timeout(r._timeout),
     _connectionId(r._connectionId)
@@ -1839,5 +1845,6 @@ void
 IceInternal::RoutableReference::setBatchRequestQueue()
 {
     _batchRequestQueue = isBatch() ?
-        make_shared<BatchRequestQueue>(getInstance(), getMode() == Reference::ModeBatchDatagram) : nullptr;
+        make_shared<BatchRequestQueue>(getInstance(), getMode() == Reference::ModeBatchDatagram, _batchAutoFlushSize,
+                                       _batchAutoFlushDelay) : nullptr;
 }
@@ -238,7 +238,7 @@ public:
     RoutableReference(const InstancePtr&, const Ice::CommunicatorPtr&, const Ice::Identity&, const std::string&, Mode,
                       bool, const Ice::ProtocolVersion&, const Ice::EncodingVersion&, const std::vector<EndpointIPtr>&,
                       const std::string&, const LocatorInfoPtr&, const RouterInfoPtr&, bool, bool, bool,
-                      Ice::EndpointSelectionType, int, int, const Ice::Context&);
+                      Ice::EndpointSelectionType, int, int, const Ice::Context&, size_t, int);
 
     RoutableReference(const RoutableReference&);
 
@@ -324,6 +324,8 @@ private:
     bool _preferSecure;
     Ice::EndpointSelectionType _endpointSelection;
     int _locatorCacheTimeout;
+    size_t _batchAutoFlushSize;
+    int _batchAutoFlushDelay;
 
     bool _overrideTimeout;
     int _timeout; // Only used if _overrideTimeout == true
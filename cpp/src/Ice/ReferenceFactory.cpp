@@ -635,6 +635,8 @@ IceInternal::ReferenceFactory::checkForUnknownProperties(const string& prefix)
         "PreferSecure",
         "LocatorCacheTimeout",
         "InvocationTimeout",
+        "BatchAutoFlushSize",
+        "BatchAutoFlushDelay",
         "Locator",
         "Router",
         "CollocationOptimized",
@@ -720,6 +722,8 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
     int locatorCacheTimeout = defaultsAndOverrides->defaultLocatorCacheTimeout;
     int invocationTimeout = defaultsAndOverrides->defaultInvocationTimeout;
     Ice::Context ctx;
+    size_t batchAutoFlushSize = _instance->batchAutoFlushSize();
+    int batchAutoFlushDelay = _instance->batchAutoFlushDelay();
 
     //
     // Override the defaults with the proxy properties if a property prefix is defined.
@@ -822,6 +826,41 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
             }
         }
 
+        property = propertyPrefix + ".BatchAutoFlushSize";
+        value = properties->getProperty(property);
+        if(!value.empty())
+        {
+            int32_t num = properties->getPropertyAsInt(property);
+            if(num < 1)
+            {
+                batchAutoFlushSize = 0; // Disabled
+            }
+            else if(static_cast<size_t>(num) > static_cast<size_t>(0x7fffffff / 1024))
+            {
+                batchAutoFlushSize = static_cast<size_t>(0x7fffffff);
+            }
+            else
+            {
+                // Property is in kilobytes, convert in bytes.
+                batchAutoFlushSize = static_cast<size_t>(num) * 1024;
+            }
+        }
+
+        property = propertyPrefix + ".BatchAutoFlushDelay";
+        value = properties->getProperty(property);
+        if(!value.empty())
+        {
+            batchAutoFlushDelay = properties->getPropertyAsIntWithDefault(property, batchAutoFlushDelay);
+            if(batchAutoFlushDelay < 0)
+            {
+                batchAutoFlushDelay = 0;
+
+                Warning out(_instance->initializationData().logger);
+                out << "invalid value for " << property << "`" << properties->getProperty(property) << "'"
+                    << ": defaulting to 0";
+            }
+        }
+
         property = propertyPrefix + ".Context.";
         PropertyDict contexts = properties->getPropertiesForPrefix(property);
         for(PropertyDict::const_iterator p = contexts.begin(); p != contexts.end(); ++p)
@@ -852,5 +891,7 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
         endpointSelection,
         locatorCacheTimeout,
         invocationTimeout,
-        ctx);
+        ctx,
+        batchAutoFlushSize,
+        batchAutoFlushDelay);
 }
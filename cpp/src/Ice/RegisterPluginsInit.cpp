@@ -13,6 +13,12 @@ Ice::Plugin* createStringConverter(const Ice::CommunicatorPtr&, const std::strin
 Ice::Plugin* createIceUDP(const Ice::CommunicatorPtr&, const std::string&, const Ice::StringSeq&);
 Ice::Plugin* createIceTCP(const Ice::CommunicatorPtr&, const std::string&, const Ice::StringSeq&);
 Ice::Plugin* createIceWS(const Ice::CommunicatorPtr&, const std::string&, const Ice::StringSeq&);
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+Ice::Plugin* createIceUNIX(const Ice::CommunicatorPtr&, const std::string&, const Ice::StringSeq&);
+#endif
+#if defined(__linux__)
+Ice::Plugin* createIceSHM(const Ice::CommunicatorPtr&, const std::string&, const Ice::StringSeq&);
+#endif
 
 }
 
@@ -21,12 +27,18 @@ IceInternal::RegisterPluginsInit::RegisterPluginsInit()
     Ice::registerPluginFactory("IceTCP", createIceTCP, true);
 
     //
-    // Only include the UDP and WS transport plugins with non-static builds or Gem/PyPI/Swift
-    // builds.
+    // Only include the UDP, WS, Unix domain socket and shared memory transport plugins with
+    // non-static builds or Gem/PyPI/Swift builds.
     //
 #if !defined(ICE_STATIC_LIBS) || defined(ICE_GEM) || defined(ICE_PYPI) || defined(ICE_SWIFT)
     Ice::registerPluginFactory("IceUDP", createIceUDP, true);
     Ice::registerPluginFactory("IceWS", createIceWS, true);
+#   if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+    Ice::registerPluginFactory("IceUNIX", createIceUNIX, true);
+#   endif
+#   if defined(__linux__)
+    Ice::registerPluginFactory("IceSHM", createIceSHM, true);
+#   endif
 #endif
 
     //
@@ -10,6 +10,10 @@
 
 #include <IceUtil/Thread.h>
 
+#if defined(ICE_HAS_IO_URING)
+#   include <Ice/IoUring.h>
+#endif
+
 #ifdef ICE_USE_CFSTREAM
 #   include <CoreFoundation/CoreFoundation.h>
 #   include <CoreFoundation/CFStream.h>
@@ -25,6 +29,34 @@ using namespace IceInternal;
 namespace
 {
 struct timespec zeroTimeout = { 0, 0 };
+}
+#elif defined(ICE_HAS_IO_URING)
+namespace
+{
+
+//
+// io_uring user data tags, poll requests for event handlers use increasing
+// identifiers starting at ioUringFirstId.
+//
+const uint64_t ioUringInterruptTag = 0;
+const uint64_t ioUringRemoveTag = 1;
+const uint64_t ioUringFirstId = 2;
+
+uint32_t
+toPollEvents(SocketOperation status)
+{
+    uint32_t events = 0;
+    if(status & SocketOperationRead)
+    {
+        events |= POLLIN;
+    }
+    if(status & SocketOperationWrite)
+    {
+        events |= POLLOUT;
+    }
+    return events;
+}
+
 }
 #endif
 
@@ -177,7 +209,15 @@ Selector::completed(EventHandler* handler, SocketOperation op)
 
 #elif defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL) || defined(ICE_USE_SELECT) || defined(ICE_USE_POLL)
 
-Selector::Selector(const InstancePtr& instance) : _instance(instance), _interrupted(false)
+Selector::Selector(const InstancePtr& instance) :
+    _instance(instance),
+    _interrupted(false),
+    _busyPoll(0),
+    _spinTime(0),
+    _blockedTime(0)
+#if defined(ICE_HAS_IO_URING)
+    , _ioUringNextId(ioUringFirstId)
+#endif
 {
     SOCKET fds[2];
     createPipe(fds);
@@ -231,9 +271,34 @@ Selector::Selector(const InstancePtr& instance) : _instance(instance), _interrup
 #endif
 }
 
+#if defined(ICE_HAS_IO_URING)
+Selector::~Selector()
+{
+    // Out of line to destroy the io_uring instance.
+}
+
+void
+Selector::setupIoUring(unsigned int entries)
+{
+    //
+    // Event handlers are registered with one-shot poll requests which are
+    // re-armed once the thread pool is done with the ready handlers. The
+    // re-arm and registration requests are submitted with the same system
+    // call used to wait for completions whenever possible.
+    //
+    _ioUring.reset(new IoUring(entries));
+    _ioUring->pollAdd(_fdIntrRead, POLLIN, ioUringInterruptTag);
+    _ioUring->submit();
+}
+#endif
+
 void
 Selector::destroy()
 {
+#if defined(ICE_HAS_IO_URING)
+    _ioUring.reset();
+#endif
+
 #if defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL)
     try
     {
@@ -305,6 +370,13 @@ Selector::enable(EventHandler* handler, SocketOperation status)
     if(handler->_registered & status)
     {
 #if defined(ICE_USE_EPOLL)
+#   if defined(ICE_HAS_IO_URING)
+        if(_ioUring)
+        {
+            updateIoUring(handler, static_cast<SocketOperation>(handler->_registered & ~handler->_disabled));
+            return;
+        }
+#   endif
         SOCKET fd = nativeInfo->fd();
         SocketOperation previous = static_cast<SocketOperation>(handler->_registered & ~(handler->_disabled | status));
         SocketOperation newStatus = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled);
@@ -359,6 +431,13 @@ Selector::disable(EventHandler* handler, SocketOperation status)
     if(handler->_registered & status)
     {
 #if defined(ICE_USE_EPOLL)
+#   if defined(ICE_HAS_IO_URING)
+        if(_ioUring)
+        {
+            updateIoUring(handler, static_cast<SocketOperation>(handler->_registered & ~handler->_disabled));
+            return;
+        }
+#   endif
         SOCKET fd = nativeInfo->fd();
         SocketOperation newStatus = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled);
         epoll_event event;
@@ -419,6 +498,16 @@ Selector::finish(EventHandler* handler, bool closeNow)
     {
         return false;
     }
+#elif defined(ICE_HAS_IO_URING)
+    if(_ioUring && _ioUring->hasPending())
+    {
+        //
+        // Submit the removal of the poll request now rather than waiting for
+        // the next select, the kernel holds a reference on the socket until
+        // the request is removed.
+        //
+        submitIoUring();
+    }
 #endif
 
     return closeNow;
@@ -503,6 +592,11 @@ Selector::startSelect()
     {
         updateSelector();
     }
+#elif defined(ICE_HAS_IO_URING)
+    if(_ioUring)
+    {
+        _ioUring->flush(); // Pending requests are submitted by select().
+    }
 #endif
     _selecting = true;
 
@@ -525,6 +619,66 @@ Selector::finishSelect(vector<pair<EventHandler*, SocketOperation> >& handlers)
     {
         return;
     }
+#elif defined(ICE_HAS_IO_URING)
+    if(_ioUring)
+    {
+        _ioUringEvents.clear();
+        unsigned int count = _ioUring->ready();
+        for(unsigned int i = 0; i < count; ++i)
+        {
+            const io_uring_cqe& cqe = _ioUring->cqe(i);
+            if(cqe.user_data == ioUringRemoveTag)
+            {
+                continue;
+            }
+
+            pair<EventHandler*, SocketOperation> p(nullptr, SocketOperationRead);
+            if(cqe.user_data == ioUringInterruptTag)
+            {
+                _ioUring->pollAdd(_fdIntrRead, POLLIN, ioUringInterruptTag);
+            }
+            else
+            {
+                auto q = _ioUringHandlers.find(cqe.user_data);
+                if(q == _ioUringHandlers.end())
+                {
+                    continue; // Completion of a poll request which was removed.
+                }
+
+                p.first = q->second.first;
+                if(cqe.res < 0)
+                {
+                    p.second = q->second.second; // Let the handler report the error.
+                }
+                else
+                {
+                    p.second = static_cast<SocketOperation>(((cqe.res & (POLLIN | POLLERR | POLLHUP)) ?
+                                                             SocketOperationRead : SocketOperationNone) |
+                                                            ((cqe.res & (POLLOUT | POLLERR | POLLHUP)) ?
+                                                             SocketOperationWrite : SocketOperationNone));
+                }
+
+                //
+                // Re-arm the one-shot poll request, it will be submitted with the next
+                // select once the handler is done with the operation.
+                //
+                _ioUring->pollAdd(p.first->getNativeInfo()->fd(), toPollEvents(q->second.second), q->first);
+            }
+
+            auto r = find_if(_ioUringEvents.begin(), _ioUringEvents.end(),
+                             [&p](const pair<EventHandler*, SocketOperation>& e) { return e.first == p.first; });
+            if(r != _ioUringEvents.end())
+            {
+                r->second = static_cast<SocketOperation>(r->second | p.second);
+            }
+            else
+            {
+                _ioUringEvents.push_back(p);
+            }
+        }
+        _ioUring->consume(count);
+        _count = static_cast<int>(_ioUringEvents.size());
+    }
 #endif
 
 #if defined(ICE_USE_POLL)
@@ -536,12 +690,21 @@ Selector::finishSelect(vector<pair<EventHandler*, SocketOperation> >& handlers)
         pair<EventHandler*, SocketOperation> p;
 
 #if defined(ICE_USE_EPOLL)
-        struct epoll_event& ev = _events[i];
-        p.first = reinterpret_cast<EventHandler*>(ev.data.ptr);
-        p.second = static_cast<SocketOperation>(((ev.events & (EPOLLIN | EPOLLERR)) ?
-                                                 SocketOperationRead : SocketOperationNone) |
-                                                ((ev.events & (EPOLLOUT | EPOLLERR)) ?
-                                                 SocketOperationWrite : SocketOperationNone));
+#   if defined(ICE_HAS_IO_URING)
+        if(_ioUring)
+        {
+            p = _ioUringEvents[static_cast<size_t>(i)];
+        }
+        else
+#   endif
+        {
+            struct epoll_event& ev = _events[static_cast<size_t>(i)];
+            p.first = reinterpret_cast<EventHandler*>(ev.data.ptr);
+            p.second = static_cast<SocketOperation>(((ev.events & (EPOLLIN | EPOLLERR)) ?
+                                                     SocketOperationRead : SocketOperationNone) |
+                                                    ((ev.events & (EPOLLOUT | EPOLLERR)) ?
+                                                     SocketOperationWrite : SocketOperationNone));
+        }
 #elif defined(ICE_USE_KQUEUE)
         struct kevent& ev = _events[static_cast<size_t>(i)];
         if(ev.flags & EV_ERROR)
@@ -648,17 +811,40 @@ Selector::select(int timeout)
         timeout = -1;
     }
 
+    //
+    // With busy polling, we poll without blocking until a handler is ready or
+    // the busy poll time elapsed, and only then block with the given timeout.
+    //
+    bool spinning = _busyPoll > 0 && timeout != 0;
+    chrono::steady_clock::time_point start;
+    if(spinning)
+    {
+        start = chrono::steady_clock::now();
+        _spinTime = 0;
+        _blockedTime = 0;
+    }
+
     int spuriousWakeup = 0;
     while(true)
     {
+        int wait = spinning ? 0 : timeout;
 #if defined(ICE_USE_EPOLL)
-        _count = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
+#   if defined(ICE_HAS_IO_URING)
+        if(_ioUring)
+        {
+            _count = _ioUring->wait(wait);
+        }
+        else
+#   endif
+        {
+            _count = epoll_wait(_queueFd, &_events[0], static_cast<int>(_events.size()), wait);
+        }
 #elif defined(ICE_USE_KQUEUE)
         assert(!_events.empty());
-        if(timeout >= 0)
+        if(wait >= 0)
         {
             struct timespec ts;
-            ts.tv_sec = timeout;
+            ts.tv_sec = wait;
             ts.tv_nsec = 0;
             _count = kevent(_queueFd, 0, 0, &_events[0], static_cast<int>(_events.size()), &ts);
         }
@@ -670,10 +856,10 @@ Selector::select(int timeout)
         fd_set* rFdSet = fdSetCopy(_selectedReadFdSet, _readFdSet);
         fd_set* wFdSet = fdSetCopy(_selectedWriteFdSet, _writeFdSet);
         fd_set* eFdSet = fdSetCopy(_selectedErrorFdSet, _errorFdSet);
-        if(timeout >= 0)
+        if(wait >= 0)
         {
             struct timeval tv;
-            tv.tv_sec = timeout;
+            tv.tv_sec = wait;
             tv.tv_usec = 0;
             _count = ::select(0, rFdSet, wFdSet, eFdSet, &tv); // The first parameter is ignored on Windows
         }
@@ -682,7 +868,7 @@ Selector::select(int timeout)
             _count = ::select(0, rFdSet, wFdSet, eFdSet, 0); // The first parameter is ignored on Windows
         }
 #else
-        _count = poll(&_pollFdSet[0], _pollFdSet.size(), timeout);
+        _count = poll(&_pollFdSet[0], _pollFdSet.size(), wait);
 #endif
 
         if(_count == SOCKET_ERROR)
@@ -697,6 +883,17 @@ Selector::select(int timeout)
             out << "selector failed:\n" << ex;
             std::this_thread::sleep_for(5s); // Sleep 5s to avoid looping
         }
+        else if(_count == 0 && spinning)
+        {
+            auto now = chrono::steady_clock::now();
+            if(now - start >= chrono::microseconds(_busyPoll))
+            {
+                _spinTime = chrono::duration_cast<chrono::microseconds>(now - start).count();
+                start = now;
+                spinning = false;
+            }
+            continue;
+        }
         else if(_count == 0 && timeout < 0)
         {
             if(++spuriousWakeup > 100)
@@ -710,6 +907,19 @@ Selector::select(int timeout)
         break;
     }
 
+    if(_busyPoll > 0 && timeout != 0)
+    {
+        int64_t elapsed = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+        if(spinning)
+        {
+            _spinTime = elapsed;
+        }
+        else
+        {
+            _blockedTime = elapsed;
+        }
+    }
+
     if(_count == 0 && !_selectNow)
     {
         throw SelectorTimeoutException();
@@ -864,6 +1074,13 @@ Selector::updateSelectorForEventHandler(EventHandler* handler,
                                         ICE_MAYBE_UNUSED SocketOperation add)
 {
 #if defined(ICE_USE_EPOLL)
+#   if defined(ICE_HAS_IO_URING)
+    if(_ioUring)
+    {
+        updateIoUring(handler, static_cast<SocketOperation>(handler->_registered & ~handler->_disabled));
+        return;
+    }
+#   endif
     SocketOperation previous = handler->_registered;
     previous = static_cast<SocketOperation>(previous & ~add);
     previous = static_cast<SocketOperation>(previous | remove);
@@ -948,6 +1165,73 @@ Selector::updateSelectorForEventHandler(EventHandler* handler,
     checkReady(handler);
 }
 
+#if defined(ICE_HAS_IO_URING)
+void
+Selector::updateIoUring(EventHandler* handler, SocketOperation status)
+{
+    //
+    // Poll requests can't be modified, the current request is removed and a
+    // new request with a new identifier is added instead. Completions for the
+    // previous identifier are ignored by finishSelect.
+    //
+    status = static_cast<SocketOperation>(status & (SocketOperationRead | SocketOperationWrite));
+    try
+    {
+        map<EventHandler*, uint64_t>::iterator p = _ioUringPolls.find(handler);
+        if(p != _ioUringPolls.end())
+        {
+            map<uint64_t, pair<EventHandler*, SocketOperation> >::iterator q = _ioUringHandlers.find(p->second);
+            assert(q != _ioUringHandlers.end());
+            if(q->second.second == status)
+            {
+                return;
+            }
+            _ioUring->pollRemove(p->second, ioUringRemoveTag);
+            _ioUringHandlers.erase(q);
+            _ioUringPolls.erase(p);
+        }
+
+        if(status)
+        {
+            SOCKET fd = handler->getNativeInfo()->fd();
+            assert(fd != INVALID_SOCKET);
+            uint64_t id = _ioUringNextId++;
+            _ioUring->pollAdd(fd, toPollEvents(status), id);
+            _ioUringPolls.insert(make_pair(handler, id));
+            _ioUringHandlers.insert(make_pair(id, make_pair(handler, status)));
+        }
+
+        //
+        // If a thread is already waiting for completions, the requests must be
+        // submitted now. Otherwise, they are submitted with the next select.
+        //
+        if(_selecting)
+        {
+            _ioUring->submit();
+        }
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        Ice::Error out(_instance->initializationData().logger);
+        out << "error while updating selector:\n" << ex;
+    }
+}
+
+void
+Selector::submitIoUring()
+{
+    try
+    {
+        _ioUring->submit();
+    }
+    catch(const Ice::LocalException& ex)
+    {
+        Ice::Error out(_instance->initializationData().logger);
+        out << "error while updating selector:\n" << ex;
+    }
+}
+#endif
+
 #elif defined(ICE_USE_CFSTREAM)
 
 namespace
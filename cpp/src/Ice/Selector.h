@@ -24,6 +24,10 @@
 
 #include <condition_variable>
 
+#if defined(ICE_HAS_IO_URING)
+#   include <memory>
+#endif
+
 #if defined(ICE_USE_CFSTREAM)
 #   include <IceUtil/Thread.h>
 #   include <set>
@@ -41,6 +45,10 @@ typedef struct __CFSocket * CFSocketRef;
 namespace IceInternal
 {
 
+#if defined(ICE_HAS_IO_URING)
+class IoUring;
+#endif
+
 //
 // Exception raised if select times out.
 //
@@ -82,6 +90,16 @@ class Selector final
 public:
 
     Selector(const InstancePtr&);
+#if defined(ICE_HAS_IO_URING)
+    ~Selector();
+
+    void setupIoUring(unsigned int);
+#endif
+
+    void setupBusyPoll(int busyPoll)
+    {
+        _busyPoll = busyPoll;
+    }
 
     void destroy();
 
@@ -100,12 +118,28 @@ public:
     void finishSelect(std::vector<std::pair<EventHandler*, SocketOperation> >&);
     void select(int);
 
+    //
+    // The time spent polling and blocked by the last select with busy polling, in microseconds.
+    //
+    std::int64_t spinTime() const
+    {
+        return _spinTime;
+    }
+    std::int64_t blockedTime() const
+    {
+        return _blockedTime;
+    }
+
 private:
 
     void wakeup();
     void checkReady(EventHandler*);
     void updateSelector();
     void updateSelectorForEventHandler(EventHandler*, SocketOperation, SocketOperation);
+#if defined(ICE_HAS_IO_URING)
+    void updateIoUring(EventHandler*, SocketOperation);
+    void submitIoUring();
+#endif
 
     const InstancePtr _instance;
 
@@ -116,10 +150,20 @@ private:
     int _count;
     bool _selecting;
     std::map<EventHandlerPtr, SocketOperation> _readyHandlers;
+    int _busyPoll;
+    std::int64_t _spinTime;
+    std::int64_t _blockedTime;
 
 #if defined(ICE_USE_EPOLL)
     std::vector<struct epoll_event> _events;
     int _queueFd;
+#   if defined(ICE_HAS_IO_URING)
+    std::unique_ptr<IoUring> _ioUring;
+    std::map<EventHandler*, std::uint64_t> _ioUringPolls;
+    std::map<std::uint64_t, std::pair<EventHandler*, SocketOperation> > _ioUringHandlers;
+    std::uint64_t _ioUringNextId;
+    std::vector<std::pair<EventHandler*, SocketOperation> > _ioUringEvents;
+#   endif
 #elif defined(ICE_USE_KQUEUE)
     std::vector<struct kevent> _events;
     std::vector<struct kevent> _changes;
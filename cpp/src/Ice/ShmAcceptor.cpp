@@ -0,0 +1,75 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Config.h>
+
+#if defined(__linux__)
+
+#include <Ice/ShmAcceptor.h>
+#include <Ice/ShmTransceiver.h>
+#include <Ice/ShmEndpointI.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+NativeInfoPtr
+IceInternal::ShmAcceptor::getNativeInfo()
+{
+    return _delegate->getNativeInfo();
+}
+
+void
+IceInternal::ShmAcceptor::close()
+{
+    _delegate->close();
+}
+
+EndpointIPtr
+IceInternal::ShmAcceptor::listen()
+{
+    _endpoint = _endpoint->endpoint(_delegate->listen());
+    return _endpoint;
+}
+
+TransceiverPtr
+IceInternal::ShmAcceptor::accept()
+{
+    //
+    // The shared memory segment is received in ShmTransceiver::initialize,
+    // since accept must not block.
+    //
+    return make_shared<ShmTransceiver>(_instance, _delegate->accept(), true);
+}
+
+string
+IceInternal::ShmAcceptor::protocol() const
+{
+    return _delegate->protocol();
+}
+
+string
+IceInternal::ShmAcceptor::toString() const
+{
+    return _delegate->toString();
+}
+
+string
+IceInternal::ShmAcceptor::toDetailedString() const
+{
+    return _delegate->toDetailedString();
+}
+
+IceInternal::ShmAcceptor::ShmAcceptor(const ShmEndpointIPtr& endpoint, const ProtocolInstancePtr& instance,
+                                      const AcceptorPtr& del) :
+    _endpoint(endpoint),
+    _instance(instance),
+    _delegate(del)
+{
+}
+
+IceInternal::ShmAcceptor::~ShmAcceptor()
+{
+}
+#endif
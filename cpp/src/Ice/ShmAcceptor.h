@@ -0,0 +1,42 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_SHM_ACCEPTOR_H
+#define ICE_SHM_ACCEPTOR_H
+
+#include <Ice/TransceiverF.h>
+#include <Ice/EndpointIF.h>
+#include <Ice/Acceptor.h>
+#include <Ice/Network.h>
+#include <Ice/ProtocolInstance.h>
+
+namespace IceInternal
+{
+
+class ShmAcceptor final : public Acceptor
+{
+public:
+
+    ShmAcceptor(const ShmEndpointIPtr&, const ProtocolInstancePtr&, const AcceptorPtr&);
+    ~ShmAcceptor();
+    NativeInfoPtr getNativeInfo() final;
+
+    void close() final;
+    EndpointIPtr listen() final;
+
+    TransceiverPtr accept() final;
+    std::string protocol() const final;
+    std::string toString() const final;
+    std::string toDetailedString() const final;
+
+private:
+
+    ShmEndpointIPtr _endpoint;
+    const ProtocolInstancePtr _instance;
+    const AcceptorPtr _delegate;
+};
+
+}
+
+#endif
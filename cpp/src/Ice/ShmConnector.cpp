@@ -0,0 +1,77 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Config.h>
+
+#if defined(__linux__)
+
+#include <Ice/ShmConnector.h>
+#include <Ice/ShmTransceiver.h>
+#include <Ice/Comparable.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+TransceiverPtr
+IceInternal::ShmConnector::connect()
+{
+    return make_shared<ShmTransceiver>(_instance, _delegate->connect(), false);
+}
+
+Short
+IceInternal::ShmConnector::type() const
+{
+    return _delegate->type();
+}
+
+string
+IceInternal::ShmConnector::toString() const
+{
+    return _delegate->toString();
+}
+
+bool
+IceInternal::ShmConnector::operator==(const Connector& r) const
+{
+    const ShmConnector* p = dynamic_cast<const ShmConnector*>(&r);
+    if(!p)
+    {
+        return false;
+    }
+
+    if(this == p)
+    {
+        return true;
+    }
+
+    return Ice::targetEqualTo(_delegate, p->_delegate);
+}
+
+bool
+IceInternal::ShmConnector::operator<(const Connector& r) const
+{
+    const ShmConnector* p = dynamic_cast<const ShmConnector*>(&r);
+    if(!p)
+    {
+        return type() < r.type();
+    }
+
+    if(this == p)
+    {
+        return false;
+    }
+
+    return Ice::targetLess(_delegate, p->_delegate);
+}
+
+IceInternal::ShmConnector::ShmConnector(const ProtocolInstancePtr& instance, const ConnectorPtr& del) :
+    _instance(instance), _delegate(del)
+{
+}
+
+IceInternal::ShmConnector::~ShmConnector()
+{
+}
+#endif
@@ -0,0 +1,37 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_SHM_CONNECTOR_H
+#define ICE_SHM_CONNECTOR_H
+
+#include <Ice/TransceiverF.h>
+#include <Ice/Connector.h>
+#include <Ice/ProtocolInstance.h>
+
+namespace IceInternal
+{
+
+class ShmConnector final : public Connector
+{
+public:
+
+    ShmConnector(const ProtocolInstancePtr&, const ConnectorPtr&);
+    ~ShmConnector();
+    TransceiverPtr connect() final;
+
+    Ice::Short type() const final;
+    std::string toString() const final;
+
+    bool operator==(const Connector&) const final;
+    bool operator<(const Connector&) const final;
+
+private:
+
+    const ProtocolInstancePtr _instance;
+    const ConnectorPtr _delegate;
+};
+
+}
+
+#endif
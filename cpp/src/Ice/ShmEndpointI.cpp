@@ -0,0 +1,298 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Config.h>
+
+#if defined(__linux__)
+
+#include <Ice/ShmEndpointI.h>
+#include <Ice/ShmAcceptor.h>
+#include <Ice/ShmConnector.h>
+#include <Ice/OutputStream.h>
+#include <Ice/InputStream.h>
+#include <Ice/ProtocolInstance.h>
+#include <Ice/Comparable.h>
+#include <Ice/Initialize.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+extern "C"
+{
+
+Plugin*
+createIceSHM(const CommunicatorPtr& c, const string&, const StringSeq&)
+{
+    return new EndpointFactoryPlugin(
+        c,
+        make_shared<ShmEndpointFactory>(make_shared<ProtocolInstance>(c, SHMEndpointType, "shm", false),
+                                        UNIXEndpointType));
+}
+
+}
+
+namespace Ice
+{
+
+ICE_API void
+registerIceSHM(bool loadOnInitialize)
+{
+    Ice::registerPluginFactory("IceSHM", createIceSHM, loadOnInitialize);
+}
+
+}
+
+IceInternal::ShmEndpointI::ShmEndpointI(const ProtocolInstancePtr& instance, const EndpointIPtr& del) :
+    _instance(instance), _delegate(del)
+{
+}
+
+EndpointInfoPtr
+IceInternal::ShmEndpointI::getInfo() const noexcept
+{
+    auto info = make_shared<InfoI<SHMEndpointInfo>>(const_cast<ShmEndpointI*>(this)->shared_from_this());
+    info->underlying = _delegate->getInfo();
+    info->compress = info->underlying->compress;
+    info->timeout = info->underlying->timeout;
+    return info;
+}
+
+Short
+IceInternal::ShmEndpointI::type() const
+{
+    return _delegate->type();
+}
+
+const string&
+IceInternal::ShmEndpointI::protocol() const
+{
+    return _delegate->protocol();
+}
+
+void
+IceInternal::ShmEndpointI::streamWriteImpl(OutputStream* s) const
+{
+    _delegate->streamWriteImpl(s);
+}
+
+int32_t
+IceInternal::ShmEndpointI::timeout() const
+{
+    return _delegate->timeout();
+}
+
+EndpointIPtr
+IceInternal::ShmEndpointI::timeout(int32_t timeout) const
+{
+    if(timeout == _delegate->timeout())
+    {
+        return const_cast<ShmEndpointI*>(this)->shared_from_this();
+    }
+    else
+    {
+        return make_shared<ShmEndpointI>(_instance, _delegate->timeout(timeout));
+    }
+}
+
+const string&
+IceInternal::ShmEndpointI::connectionId() const
+{
+    return _delegate->connectionId();
+}
+
+EndpointIPtr
+IceInternal::ShmEndpointI::connectionId(const string& connectionId) const
+{
+    if(connectionId == _delegate->connectionId())
+    {
+        return const_cast<ShmEndpointI*>(this)->shared_from_this();
+    }
+    else
+    {
+        return make_shared<ShmEndpointI>(_instance, _delegate->connectionId(connectionId));
+    }
+}
+
+bool
+IceInternal::ShmEndpointI::compress() const
+{
+    return _delegate->compress();
+}
+
+EndpointIPtr
+IceInternal::ShmEndpointI::compress(bool compress) const
+{
+    if(compress == _delegate->compress())
+    {
+        return const_cast<ShmEndpointI*>(this)->shared_from_this();
+    }
+    else
+    {
+        return make_shared<ShmEndpointI>(_instance, _delegate->compress(compress));
+    }
+}
+
+bool
+IceInternal::ShmEndpointI::datagram() const
+{
+    return false;
+}
+
+bool
+IceInternal::ShmEndpointI::secure() const
+{
+    return _delegate->secure();
+}
+
+TransceiverPtr
+IceInternal::ShmEndpointI::transceiver() const
+{
+    return nullptr;
+}
+
+void
+IceInternal::ShmEndpointI::connectorsAsync(
+    EndpointSelectionType selType,
+    function<void(vector<IceInternal::ConnectorPtr>)> response,
+    function<void(exception_ptr)> exception) const
+{
+    auto self = const_cast<ShmEndpointI*>(this)->shared_from_this();
+    _delegate->connectorsAsync(
+        selType,
+        [response, self](vector<ConnectorPtr> connectors)
+        {
+            for(vector<ConnectorPtr>::iterator it = connectors.begin(); it != connectors.end(); it++)
+            {
+                *it = make_shared<ShmConnector>(self->_instance, *it);
+            }
+            response(std::move(connectors));
+        },
+        exception);
+}
+
+AcceptorPtr
+IceInternal::ShmEndpointI::acceptor(const string& adapterName) const
+{
+    AcceptorPtr delAcc = _delegate->acceptor(adapterName);
+    return make_shared<ShmAcceptor>(const_cast<ShmEndpointI*>(this)->shared_from_this(), _instance, delAcc);
+}
+
+ShmEndpointIPtr
+IceInternal::ShmEndpointI::endpoint(const EndpointIPtr& delEndp) const
+{
+    if(delEndp.get() == _delegate.get())
+    {
+        return const_cast<ShmEndpointI*>(this)->shared_from_this();
+    }
+    else
+    {
+        return make_shared<ShmEndpointI>(_instance, delEndp);
+    }
+}
+
+vector<EndpointIPtr>
+IceInternal::ShmEndpointI::expandIfWildcard() const
+{
+    vector<EndpointIPtr> endps;
+    endps.push_back(const_cast<ShmEndpointI*>(this)->shared_from_this());
+    return endps;
+}
+
+vector<EndpointIPtr>
+IceInternal::ShmEndpointI::expandHost(EndpointIPtr&) const
+{
+    //
+    // Nothing to do here, the Unix domain socket path isn't expanded.
+    //
+    vector<EndpointIPtr> endps;
+    endps.push_back(const_cast<ShmEndpointI*>(this)->shared_from_this());
+    return endps;
+}
+
+bool
+IceInternal::ShmEndpointI::equivalent(const EndpointIPtr& endpoint) const
+{
+    const ShmEndpointI* shmEndpointI = dynamic_cast<const ShmEndpointI*>(endpoint.get());
+    if(!shmEndpointI)
+    {
+        return false;
+    }
+    return _delegate->equivalent(shmEndpointI->_delegate);
+}
+
+int32_t
+IceInternal::ShmEndpointI::hash() const
+{
+    return _delegate->hash();
+}
+
+string
+IceInternal::ShmEndpointI::options() const
+{
+    return _delegate->options();
+}
+
+bool
+IceInternal::ShmEndpointI::operator==(const Endpoint& r) const
+{
+    const ShmEndpointI* p = dynamic_cast<const ShmEndpointI*>(&r);
+    if(!p)
+    {
+        return false;
+    }
+
+    if(this == p)
+    {
+        return true;
+    }
+
+    return targetEqualTo(_delegate, p->_delegate);
+}
+
+bool
+IceInternal::ShmEndpointI::operator<(const Endpoint& r) const
+{
+    const ShmEndpointI* p = dynamic_cast<const ShmEndpointI*>(&r);
+    if(!p)
+    {
+        const EndpointI* e = dynamic_cast<const EndpointI*>(&r);
+        if(!e)
+        {
+            return false;
+        }
+        return type() < e->type();
+    }
+
+    if(this == p)
+    {
+        return false;
+    }
+
+    return targetLess(_delegate, p->_delegate);
+}
+
+IceInternal::ShmEndpointFactory::ShmEndpointFactory(const ProtocolInstancePtr& instance, Short type) :
+    EndpointFactoryWithUnderlying(instance, type)
+{
+}
+
+EndpointFactoryPtr
+IceInternal::ShmEndpointFactory::cloneWithUnderlying(const ProtocolInstancePtr& instance, Short underlying) const
+{
+    return make_shared<ShmEndpointFactory>(instance, underlying);
+}
+
+EndpointIPtr
+IceInternal::ShmEndpointFactory::createWithUnderlying(const EndpointIPtr& underlying, vector<string>&, bool) const
+{
+    return make_shared<ShmEndpointI>(_instance, underlying);
+}
+
+EndpointIPtr
+IceInternal::ShmEndpointFactory::readWithUnderlying(const EndpointIPtr& underlying, InputStream*) const
+{
+    return make_shared<ShmEndpointI>(_instance, underlying);
+}
+#endif
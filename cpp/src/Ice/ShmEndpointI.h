@@ -0,0 +1,84 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_SHM_ENDPOINT_I_H
+#define ICE_SHM_ENDPOINT_I_H
+
+#include <IceUtil/Config.h>
+#include <Ice/EndpointI.h>
+#include <Ice/EndpointFactory.h>
+#include <Ice/ProtocolInstanceF.h>
+
+namespace IceInternal
+{
+
+//
+// An endpoint for shared memory connections. The endpoint delegates to a Unix
+// domain socket endpoint, the socket is used to exchange the shared memory
+// segment when the connection is established and to wake up the peer.
+//
+class ShmEndpointI final : public EndpointI, public std::enable_shared_from_this<ShmEndpointI>
+{
+public:
+
+    ShmEndpointI(const ProtocolInstancePtr&, const EndpointIPtr&);
+
+    void streamWriteImpl(Ice::OutputStream*) const final;
+
+    Ice::EndpointInfoPtr getInfo() const noexcept final;
+    Ice::Short type() const final;
+    const std::string& protocol() const final;
+
+    std::int32_t timeout() const final;
+    EndpointIPtr timeout(std::int32_t) const final;
+    const std::string& connectionId() const final;
+    EndpointIPtr connectionId(const ::std::string&) const final;
+    bool compress() const final;
+    EndpointIPtr compress(bool) const final;
+    bool datagram() const final;
+    bool secure() const final;
+
+    TransceiverPtr transceiver() const final;
+    void connectorsAsync(
+        Ice::EndpointSelectionType,
+        std::function<void(std::vector<ConnectorPtr>)>,
+        std::function<void(std::exception_ptr)>) const final;
+    AcceptorPtr acceptor(const std::string&) const final;
+    std::vector<EndpointIPtr> expandIfWildcard() const final;
+    std::vector<EndpointIPtr> expandHost(EndpointIPtr&) const final;
+    bool equivalent(const EndpointIPtr&) const final;
+    ::std::int32_t hash() const final;
+    std::string options() const final;
+
+    ShmEndpointIPtr endpoint(const EndpointIPtr&) const;
+
+    bool operator==(const Ice::Endpoint&) const final;
+    bool operator<(const Ice::Endpoint&) const final;
+
+private:
+
+    //
+    // All members are const, because endpoints are immutable.
+    //
+    const ProtocolInstancePtr _instance;
+    const EndpointIPtr _delegate;
+};
+
+class ShmEndpointFactory final : public EndpointFactoryWithUnderlying
+{
+public:
+
+    ShmEndpointFactory(const ProtocolInstancePtr&, Ice::Short);
+
+    EndpointFactoryPtr cloneWithUnderlying(const ProtocolInstancePtr&, Ice::Short) const final;
+
+protected:
+
+    EndpointIPtr createWithUnderlying(const EndpointIPtr&, std::vector<std::string>&, bool) const final;
+    EndpointIPtr readWithUnderlying(const EndpointIPtr&, Ice::InputStream*) const final;
+};
+
+}
+
+#endif
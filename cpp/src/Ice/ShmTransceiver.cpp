@@ -0,0 +1,818 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Config.h>
+
+#if defined(__linux__)
+
+#include <Ice/ShmTransceiver.h>
+#include <Ice/Connection.h>
+#include <Ice/ProtocolInstance.h>
+#include <Ice/Properties.h>
+#include <Ice/Buffer.h>
+#include <Ice/LocalException.h>
+
+#include <chrono>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+//
+// The control block of a ring buffer. The producer and consumer positions are
+// free running counters on separate cache lines. A consumer which waits for
+// data sets readerWaiting and a producer which waits for space sets
+// writerWaiting, the peer sends a doorbell byte over the socket when it clears
+// the flag.
+//
+struct IceInternal::ShmTransceiver::Ring
+{
+    alignas(64) atomic<uint64_t> head;
+    alignas(64) atomic<uint64_t> tail;
+    alignas(64) atomic<uint32_t> readerWaiting;
+    atomic<uint32_t> writerWaiting;
+};
+
+namespace
+{
+
+//
+// The segment starts with the control blocks of the client to server and
+// server to client rings, followed by the data of these rings.
+//
+const size_t segmentHeaderSize = 4096;
+const size_t minRingSize = 4 * 1024;
+const size_t maxRingSize = 1024 * 1024 * 1024;
+
+//
+// The message sent by the client with the file descriptor of the segment.
+//
+const Byte shmMagic[] = { 0x49, 0x53, 0x48, 0x4d }; // 'I', 'S', 'H', 'M'
+const size_t requestSize = sizeof(shmMagic) + sizeof(uint32_t);
+
+static_assert(atomic<uint64_t>::is_always_lock_free && atomic<uint32_t>::is_always_lock_free,
+              "the ring buffer positions must be lock-free to be shared between processes");
+
+inline void
+cpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+}
+
+NativeInfoPtr
+IceInternal::ShmTransceiver::getNativeInfo()
+{
+    return shared_from_this();
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::initialize(Buffer& readBuffer, Buffer& writeBuffer)
+{
+    if(_state == StateInitializeDelegate)
+    {
+        SocketOperation op = _delegate->initialize(readBuffer, writeBuffer);
+        if(op != SocketOperationNone)
+        {
+            return wait(op);
+        }
+        wait(SocketOperationRead);
+
+        if(!_incoming)
+        {
+            createSegment();
+        }
+        _state = StateHandshake;
+    }
+
+    if(_state == StateHandshake)
+    {
+        if(_incoming)
+        {
+            if(!receiveSegment())
+            {
+                return SocketOperationRead;
+            }
+        }
+        else
+        {
+            //
+            // Wait for the server to acknowledge that it mapped the segment.
+            //
+            Byte ack;
+            ssize_t ret;
+            while((ret = ::recv(_socket, &ack, 1, 0)) == SOCKET_ERROR && interrupted())
+            {
+            }
+            if(ret == 0)
+            {
+                throw ConnectionLostException(__FILE__, __LINE__, 0);
+            }
+            else if(ret == SOCKET_ERROR)
+            {
+                if(wouldBlock())
+                {
+                    return SocketOperationRead;
+                }
+                else if(connectionLost())
+                {
+                    throw ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+                }
+                throw SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+        _state = StateConnected;
+
+        //
+        // The thread pool only reads the connection once the descriptor is
+        // ready, ask the peer to ring the doorbell for the first message.
+        //
+        ready(SocketOperationRead, !waitForData());
+    }
+
+    assert(_state == StateConnected);
+    return SocketOperationNone;
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::closing(bool initiator, exception_ptr)
+{
+    // If we are initiating the connection closure, wait for the peer
+    // to close the connection. Otherwise, close immediately.
+    return initiator ? SocketOperationRead : SocketOperationNone;
+}
+
+void
+IceInternal::ShmTransceiver::close()
+{
+    if(_segment)
+    {
+        munmap(_segment, _segmentSize);
+        _segment = nullptr;
+        _in = nullptr;
+        _out = nullptr;
+    }
+
+    if(_fd != INVALID_SOCKET)
+    {
+        closeSocketNoThrow(_fd);
+        _fd = INVALID_SOCKET;
+    }
+    _delegate->close();
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::write(Buffer& buf)
+{
+    Buffer* bufs[] = { &buf };
+    return writeBuffers(bufs, 1);
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::writev(const vector<Buffer*>& bufs)
+{
+    return writeBuffers(bufs.data(), bufs.size());
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::read(Buffer& buf)
+{
+    //
+    // The connection reads with an empty buffer until it's initialized, the
+    // segment isn't mapped yet.
+    //
+    if(_state != StateConnected)
+    {
+        assert(buf.i == buf.b.end());
+        return SocketOperationNone;
+    }
+
+    //
+    // If we were waiting for the peer, we were most likely woken up by its
+    // doorbell, read it to clear the socket readiness.
+    //
+    if(_readWaiting || _writeWaiting)
+    {
+        if(_readWaiting)
+        {
+            _in->readerWaiting.store(0, memory_order_relaxed);
+            _readWaiting = false;
+        }
+        drain();
+
+        if(_writeWaiting &&
+           _out->tail.load(memory_order_relaxed) - _out->head.load(memory_order_acquire) < _ringSize)
+        {
+            //
+            // The peer made space in the ring buffer, the write is retried by
+            // the thread pool since the descriptor is never writable.
+            //
+            _out->writerWaiting.store(0, memory_order_relaxed);
+            _writeWaiting = false;
+            ready(SocketOperationWrite, true);
+        }
+    }
+
+    while(true)
+    {
+        if(readRing(buf) > 0)
+        {
+            notify(_in->writerWaiting);
+        }
+
+        if(buf.i == buf.b.end())
+        {
+            //
+            // Get called again if the ring buffer has more data, otherwise ask
+            // the peer to ring the doorbell when it writes new data.
+            //
+            ready(SocketOperationRead, hasBufferedData() || !waitForData());
+            return SocketOperationNone;
+        }
+
+        if(_spinTime > 0 && spin())
+        {
+            continue;
+        }
+
+        drain();
+        if(waitForData())
+        {
+            if(_peerClosed)
+            {
+                throw ConnectionLostException(__FILE__, __LINE__, 0);
+            }
+            ready(SocketOperationRead, false);
+            return SocketOperationRead;
+        }
+    }
+}
+
+bool
+IceInternal::ShmTransceiver::hasBufferedData() const
+{
+    return _in && _in->tail.load(memory_order_acquire) != _in->head.load(memory_order_relaxed);
+}
+
+string
+IceInternal::ShmTransceiver::protocol() const
+{
+    return _instance->protocol();
+}
+
+string
+IceInternal::ShmTransceiver::toString() const
+{
+    return _delegate->toString();
+}
+
+string
+IceInternal::ShmTransceiver::toDetailedString() const
+{
+    return _delegate->toDetailedString();
+}
+
+Ice::ConnectionInfoPtr
+IceInternal::ShmTransceiver::getInfo() const
+{
+    SHMConnectionInfoPtr info = std::make_shared<SHMConnectionInfo>();
+    info->underlying = _delegate->getInfo();
+    info->ringSize = static_cast<int>(_ringSize);
+    return info;
+}
+
+void
+IceInternal::ShmTransceiver::checkSendSize(const Buffer&)
+{
+}
+
+void
+IceInternal::ShmTransceiver::setBufferSize(int, int)
+{
+    //
+    // The size of the ring buffers is set with Ice.SHM.RingSize, the socket
+    // only carries doorbells.
+    //
+}
+
+IceInternal::ShmTransceiver::ShmTransceiver(const ProtocolInstancePtr& instance, const TransceiverPtr& del,
+                                            bool incoming) :
+    NativeInfo(epoll_create1(EPOLL_CLOEXEC)),
+    _instance(instance),
+    _delegate(del),
+    _incoming(incoming),
+    _socket(del->getNativeInfo()->fd()),
+    _state(StateInitializeDelegate),
+    _ringSize(0),
+    _spinTime(0),
+    _segment(nullptr),
+    _segmentSize(0),
+    _in(nullptr),
+    _inData(nullptr),
+    _out(nullptr),
+    _outData(nullptr),
+    _readWaiting(false),
+    _writeWaiting(false),
+    _peerClosed(false)
+{
+    if(_fd == INVALID_SOCKET)
+    {
+        int error = getSocketErrno();
+        _delegate->close();
+        throw SocketException(__FILE__, __LINE__, error);
+    }
+
+    epoll_event event;
+    memset(&event, 0, sizeof(epoll_event));
+    event.events = EPOLLIN;
+    event.data.fd = _socket;
+    if(epoll_ctl(_fd, EPOLL_CTL_ADD, _socket, &event) != 0)
+    {
+        int error = getSocketErrno();
+        closeSocketNoThrow(_fd);
+        _fd = INVALID_SOCKET;
+        _delegate->close();
+        throw SocketException(__FILE__, __LINE__, error);
+    }
+
+    //
+    // The client chooses the size of the ring buffers, it's rounded up to a
+    // power of two.
+    //
+    if(!_incoming)
+    {
+        const PropertiesPtr properties = _instance->properties();
+        size_t size = static_cast<size_t>(max(properties->getPropertyAsIntWithDefault("Ice.SHM.RingSize", 1024), 4));
+        size = min(size * 1024, maxRingSize);
+        _ringSize = minRingSize;
+        while(_ringSize < size)
+        {
+            _ringSize <<= 1;
+        }
+    }
+    _spinTime = max(_instance->properties()->getPropertyAsInt("Ice.SHM.SpinTime"), 0);
+}
+
+IceInternal::ShmTransceiver::~ShmTransceiver()
+{
+    assert(!_segment);
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::wait(SocketOperation op)
+{
+    //
+    // Watch the socket for the given operation. The epoll descriptor becomes
+    // readable when the socket is ready, so we always wait for it to be
+    // readable.
+    //
+    epoll_event event;
+    memset(&event, 0, sizeof(epoll_event));
+    if(op & SocketOperationRead)
+    {
+        event.events |= EPOLLIN;
+    }
+    if(op & (SocketOperationWrite | SocketOperationConnect))
+    {
+        event.events |= EPOLLOUT;
+    }
+    event.data.fd = _socket;
+    if(epoll_ctl(_fd, EPOLL_CTL_MOD, _socket, &event) != 0)
+    {
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+    return op == SocketOperationNone ? SocketOperationNone : SocketOperationRead;
+}
+
+void
+IceInternal::ShmTransceiver::createSegment()
+{
+    //
+    // The segment is sealed to prevent the client from shrinking it while it's
+    // mapped by the server.
+    //
+    int fd = memfd_create("ice-shm", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if(fd < 0)
+    {
+        throw SyscallException(__FILE__, __LINE__, errno);
+    }
+
+    size_t size = segmentHeaderSize + 2 * _ringSize;
+    if(ftruncate(fd, static_cast<off_t>(size)) != 0 ||
+       fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0)
+    {
+        int error = errno;
+        ::close(fd);
+        throw SyscallException(__FILE__, __LINE__, error);
+    }
+
+    try
+    {
+        map(fd, size);
+    }
+    catch(...)
+    {
+        ::close(fd);
+        throw;
+    }
+
+    Byte request[requestSize];
+    memcpy(request, shmMagic, sizeof(shmMagic));
+    uint32_t ringSize = static_cast<uint32_t>(_ringSize);
+    memcpy(request + sizeof(shmMagic), &ringSize, sizeof(ringSize));
+
+    iovec iov;
+    iov.iov_base = request;
+    iov.iov_len = requestSize;
+
+    union
+    {
+        char buf[CMSG_SPACE(sizeof(int))];
+        cmsghdr align;
+    } control;
+    memset(&control, 0, sizeof(control));
+
+    msghdr msg;
+    memset(&msg, 0, sizeof(msghdr));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+
+    //
+    // The socket was just connected, its send buffer can hold the request.
+    //
+    ssize_t ret;
+    while((ret = ::sendmsg(_socket, &msg, MSG_NOSIGNAL)) == SOCKET_ERROR && interrupted())
+    {
+    }
+    int error = getSocketErrno();
+    ::close(fd);
+
+    if(ret == SOCKET_ERROR)
+    {
+        if(connectionLost())
+        {
+            throw ConnectionLostException(__FILE__, __LINE__, error);
+        }
+        throw SocketException(__FILE__, __LINE__, error);
+    }
+    else if(static_cast<size_t>(ret) != requestSize)
+    {
+        throw SocketException(__FILE__, __LINE__, 0);
+    }
+}
+
+bool
+IceInternal::ShmTransceiver::receiveSegment()
+{
+    Byte request[requestSize];
+    iovec iov;
+    iov.iov_base = request;
+    iov.iov_len = requestSize;
+
+    union
+    {
+        char buf[CMSG_SPACE(sizeof(int))];
+        cmsghdr align;
+    } control;
+
+    msghdr msg;
+    memset(&msg, 0, sizeof(msghdr));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+
+    ssize_t ret;
+    while((ret = ::recvmsg(_socket, &msg, MSG_CMSG_CLOEXEC)) == SOCKET_ERROR && interrupted())
+    {
+    }
+
+    if(ret == 0)
+    {
+        throw ConnectionLostException(__FILE__, __LINE__, 0);
+    }
+    else if(ret == SOCKET_ERROR)
+    {
+        if(wouldBlock())
+        {
+            return false;
+        }
+        else if(connectionLost())
+        {
+            throw ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+        }
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+
+    int fd = -1;
+    for(cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    {
+        if(cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS &&
+           cmsg->cmsg_len == CMSG_LEN(sizeof(int)))
+        {
+            memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+        }
+    }
+
+    //
+    // Check the request and the segment before mapping it, the client must not
+    // be able to resize the segment once it's mapped.
+    //
+    uint32_t ringSize = 0;
+    memcpy(&ringSize, request + sizeof(shmMagic), sizeof(ringSize));
+    struct stat st;
+    if(fd < 0 || static_cast<size_t>(ret) != requestSize || memcmp(request, shmMagic, sizeof(shmMagic)) != 0 ||
+       ringSize < minRingSize || ringSize > maxRingSize || (ringSize & (ringSize - 1)) != 0 ||
+       fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) != segmentHeaderSize + 2 * ringSize ||
+       (fcntl(fd, F_GET_SEALS) & (F_SEAL_SHRINK | F_SEAL_SEAL)) != (F_SEAL_SHRINK | F_SEAL_SEAL))
+    {
+        if(fd >= 0)
+        {
+            ::close(fd);
+        }
+        throw ProtocolException(__FILE__, __LINE__, "invalid shared memory connection request");
+    }
+
+    _ringSize = ringSize;
+    try
+    {
+        map(fd, segmentHeaderSize + 2 * _ringSize);
+    }
+    catch(...)
+    {
+        ::close(fd);
+        throw;
+    }
+    ::close(fd);
+
+    Byte ack = 0;
+    while((ret = ::send(_socket, &ack, 1, MSG_NOSIGNAL)) == SOCKET_ERROR && interrupted())
+    {
+    }
+    if(ret == SOCKET_ERROR)
+    {
+        if(connectionLost())
+        {
+            throw ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+        }
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+    return true;
+}
+
+void
+IceInternal::ShmTransceiver::map(int fd, size_t size)
+{
+    static_assert(2 * sizeof(Ring) <= segmentHeaderSize, "the ring control blocks don't fit in the segment header");
+
+    void* segment = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if(segment == MAP_FAILED)
+    {
+        throw SyscallException(__FILE__, __LINE__, errno);
+    }
+    _segment = segment;
+    _segmentSize = size;
+
+    Ring* rings = static_cast<Ring*>(segment);
+    Byte* data = static_cast<Byte*>(segment) + segmentHeaderSize;
+    if(_incoming)
+    {
+        _in = &rings[0];
+        _inData = data;
+        _out = &rings[1];
+        _outData = data + _ringSize;
+    }
+    else
+    {
+        _out = &rings[0];
+        _outData = data;
+        _in = &rings[1];
+        _inData = data + _ringSize;
+    }
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::writeBuffers(Buffer* const* bufs, size_t count)
+{
+    if(_state != StateConnected)
+    {
+        return SocketOperationNone;
+    }
+
+    if(_writeWaiting)
+    {
+        _out->writerWaiting.store(0, memory_order_relaxed);
+        _writeWaiting = false;
+    }
+
+    size_t written = 0;
+    for(size_t i = 0; i < count; ++i)
+    {
+        Buffer& buf = *bufs[i];
+        while(buf.i != buf.b.end())
+        {
+            written += writeRing(buf);
+            if(buf.i == buf.b.end())
+            {
+                break;
+            }
+
+            //
+            // The ring buffer is full. Wake up the peer if it waits for the data
+            // written so far and ask it to ring the doorbell when it consumes
+            // data, unless it already did in the meantime.
+            //
+            if(written > 0)
+            {
+                notify(_out->readerWaiting);
+                written = 0;
+            }
+
+            _out->writerWaiting.store(1, memory_order_relaxed);
+            atomic_thread_fence(memory_order_seq_cst);
+            if(_out->tail.load(memory_order_relaxed) - _out->head.load(memory_order_acquire) < _ringSize)
+            {
+                _out->writerWaiting.store(0, memory_order_relaxed);
+                continue;
+            }
+            _writeWaiting = true;
+            ready(SocketOperationWrite, false);
+            return SocketOperationWrite;
+        }
+    }
+
+    if(written > 0)
+    {
+        notify(_out->readerWaiting);
+    }
+    return SocketOperationNone;
+}
+
+size_t
+IceInternal::ShmTransceiver::readRing(Buffer& buf)
+{
+    uint64_t head = _in->head.load(memory_order_relaxed);
+    uint64_t available = _in->tail.load(memory_order_acquire) - head;
+    if(available > _ringSize)
+    {
+        throw ProtocolException(__FILE__, __LINE__, "invalid shared memory ring buffer position");
+    }
+
+    size_t length = min(static_cast<size_t>(available), static_cast<size_t>(buf.b.end() - buf.i));
+    if(length == 0)
+    {
+        return 0;
+    }
+
+    size_t pos = static_cast<size_t>(head) & (_ringSize - 1);
+    size_t first = min(length, _ringSize - pos);
+    memcpy(buf.i, _inData + pos, first);
+    memcpy(buf.i + first, _inData, length - first);
+    buf.i += length;
+
+    _in->head.store(head + length, memory_order_release);
+    return length;
+}
+
+size_t
+IceInternal::ShmTransceiver::writeRing(Buffer& buf)
+{
+    uint64_t tail = _out->tail.load(memory_order_relaxed);
+    uint64_t used = tail - _out->head.load(memory_order_acquire);
+    if(used > _ringSize)
+    {
+        throw ProtocolException(__FILE__, __LINE__, "invalid shared memory ring buffer position");
+    }
+
+    size_t length = min(static_cast<size_t>(_ringSize - used), static_cast<size_t>(buf.b.end() - buf.i));
+    if(length == 0)
+    {
+        return 0;
+    }
+
+    size_t pos = static_cast<size_t>(tail) & (_ringSize - 1);
+    size_t first = min(length, _ringSize - pos);
+    memcpy(_outData + pos, buf.i, first);
+    memcpy(_outData, buf.i + first, length - first);
+    buf.i += length;
+
+    _out->tail.store(tail + length, memory_order_release);
+    return length;
+}
+
+bool
+IceInternal::ShmTransceiver::waitForData()
+{
+    //
+    // Ask the peer to ring the doorbell when it writes data. Returns false if
+    // data was written before the peer could see the request.
+    //
+    _in->readerWaiting.store(1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    if(hasBufferedData())
+    {
+        _in->readerWaiting.store(0, memory_order_relaxed);
+        return false;
+    }
+    _readWaiting = true;
+    return true;
+}
+
+bool
+IceInternal::ShmTransceiver::spin()
+{
+    auto end = chrono::steady_clock::now() + chrono::microseconds(_spinTime);
+    do
+    {
+        for(int i = 0; i < 64; ++i)
+        {
+            if(hasBufferedData())
+            {
+                return true;
+            }
+            cpuRelax();
+        }
+    }
+    while(chrono::steady_clock::now() < end);
+    return false;
+}
+
+void
+IceInternal::ShmTransceiver::drain()
+{
+    //
+    // Read the doorbells sent by the peer. The end of the stream is only
+    // reported once the data left in the ring buffer is read.
+    //
+    Byte buf[64];
+    while(!_peerClosed)
+    {
+        ssize_t ret = ::recv(_socket, buf, sizeof(buf), 0);
+        if(ret == 0)
+        {
+            _peerClosed = true;
+        }
+        else if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+            else if(wouldBlock())
+            {
+                return;
+            }
+            else if(connectionLost())
+            {
+                _peerClosed = true;
+            }
+            else
+            {
+                throw SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+        else if(static_cast<size_t>(ret) < sizeof(buf))
+        {
+            return;
+        }
+    }
+}
+
+void
+IceInternal::ShmTransceiver::notify(atomic<uint32_t>& waiting)
+{
+    //
+    // Ring the doorbell if the peer waits. Send errors are ignored: a full
+    // socket already holds doorbells and the loss of the peer is detected when
+    // reading.
+    //
+    atomic_thread_fence(memory_order_seq_cst);
+    if(waiting.load(memory_order_relaxed) && waiting.exchange(0, memory_order_relaxed))
+    {
+        Byte doorbell = 0;
+        while(::send(_socket, &doorbell, 1, MSG_NOSIGNAL) == SOCKET_ERROR && interrupted())
+        {
+        }
+    }
+}
+#endif
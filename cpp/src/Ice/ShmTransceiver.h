@@ -0,0 +1,101 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_SHM_TRANSCEIVER_H
+#define ICE_SHM_TRANSCEIVER_H
+
+#include <Ice/ProtocolInstanceF.h>
+#include <Ice/Transceiver.h>
+#include <Ice/Network.h>
+
+#include <atomic>
+
+namespace IceInternal
+{
+
+//
+// A transceiver which exchanges messages through a shared memory segment with
+// a single-producer single-consumer ring buffer for each direction.
+//
+// The connection is established with the Unix domain socket of the delegate
+// transceiver: the client creates the segment and sends its file descriptor
+// to the server. The socket is then only used as a doorbell: a byte is sent
+// to wake up the peer when it waits for data to read or for space to write.
+// The socket is watched through an epoll instance, which is the file
+// descriptor registered with the thread pool. An epoll descriptor is never
+// writable, so waiting for space in the ring buffer doesn't busy loop: the
+// transceiver instead marks itself ready for writing when it reads the
+// doorbell sent by the peer after it consumed data.
+//
+class ShmTransceiver final : public Transceiver, public NativeInfo, public std::enable_shared_from_this<ShmTransceiver>
+{
+public:
+
+    ShmTransceiver(const ProtocolInstancePtr&, const TransceiverPtr&, bool);
+    ~ShmTransceiver();
+    NativeInfoPtr getNativeInfo() final;
+
+    SocketOperation initialize(Buffer&, Buffer&) final;
+    SocketOperation closing(bool, std::exception_ptr) final;
+
+    void close() final;
+    SocketOperation write(Buffer&) final;
+    SocketOperation read(Buffer&) final;
+    SocketOperation writev(const std::vector<Buffer*>&) final;
+    bool hasBufferedData() const final;
+    std::string protocol() const final;
+    std::string toString() const final;
+    std::string toDetailedString() const final;
+    Ice::ConnectionInfoPtr getInfo() const final;
+    void checkSendSize(const Buffer&) final;
+    void setBufferSize(int rcvSize, int sndSize) final;
+
+private:
+
+    struct Ring;
+
+    SocketOperation wait(SocketOperation);
+    void createSegment();
+    bool receiveSegment();
+    void map(int, size_t);
+
+    SocketOperation writeBuffers(Buffer* const*, size_t);
+    size_t readRing(Buffer&);
+    size_t writeRing(Buffer&);
+    bool waitForData();
+    bool spin();
+    void drain();
+    void notify(std::atomic<std::uint32_t>&);
+
+    enum State
+    {
+        StateInitializeDelegate,
+        StateHandshake,
+        StateConnected
+    };
+
+    const ProtocolInstancePtr _instance;
+    const TransceiverPtr _delegate;
+    const bool _incoming;
+    const SOCKET _socket;
+    State _state;
+
+    size_t _ringSize;
+    int _spinTime;
+    void* _segment;
+    size_t _segmentSize;
+
+    Ring* _in;
+    Ice::Byte* _inData;
+    Ring* _out;
+    Ice::Byte* _outData;
+
+    bool _readWaiting;
+    bool _writeWaiting;
+    bool _peerClosed;
+};
+
+}
+
+#endif
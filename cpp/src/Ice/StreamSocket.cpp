@@ -6,6 +6,11 @@
 #include <Ice/NetworkProxy.h>
 #include <Ice/ProtocolInstance.h>
 
+#if !defined(ICE_USE_IOCP)
+#   include <sys/uio.h>
+#   include <climits>
+#endif
+
 using namespace IceInternal;
 
 StreamSocket::StreamSocket(const ProtocolInstancePtr& instance,
@@ -319,6 +324,111 @@ StreamSocket::write(const char* buf, size_t length)
     return sent;
 }
 
+#if !defined(ICE_USE_IOCP)
+SocketOperation
+StreamSocket::writev(const std::vector<Buffer*>& bufs)
+{
+    assert(_fd != INVALID_SOCKET);
+
+    if(_state != StateConnected)
+    {
+        for(std::vector<Buffer*>::const_iterator p = bufs.begin(); p != bufs.end(); ++p)
+        {
+            if((*p)->i != (*p)->b.end())
+            {
+                SocketOperation op = write(**p);
+                if(op)
+                {
+                    return op;
+                }
+            }
+        }
+        return SocketOperationNone;
+    }
+
+    const int maxIov = 64 < IOV_MAX ? 64 : IOV_MAX;
+    struct iovec iov[maxIov];
+    size_t pos = 0;
+    while(true)
+    {
+        int count = 0;
+        for(size_t n = pos; n < bufs.size() && count < maxIov; ++n)
+        {
+            if(bufs[n]->i != bufs[n]->b.end())
+            {
+                iov[count].iov_base = &*bufs[n]->i;
+                iov[count].iov_len = static_cast<size_t>(bufs[n]->b.end() - bufs[n]->i);
+                ++count;
+            }
+        }
+
+        if(count == 0)
+        {
+            return SocketOperationNone;
+        }
+
+        ssize_t ret = ::writev(_fd, iov, count);
+        if(ret == 0)
+        {
+            throw Ice::ConnectionLostException(__FILE__, __LINE__, 0);
+        }
+        else if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+
+            if(noBuffers())
+            {
+                //
+                // Fallback to write() which reduces the packet size until the
+                // send succeeds.
+                //
+                while(bufs[pos]->i == bufs[pos]->b.end())
+                {
+                    ++pos;
+                }
+                SocketOperation op = write(*bufs[pos]);
+                if(op)
+                {
+                    return op;
+                }
+                continue;
+            }
+
+            if(wouldBlock())
+            {
+                return SocketOperationWrite;
+            }
+
+            if(connectionLost())
+            {
+                throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+
+        size_t sent = static_cast<size_t>(ret);
+        while(sent > 0)
+        {
+            size_t sz = static_cast<size_t>(bufs[pos]->b.end() - bufs[pos]->i);
+            if(sent < sz)
+            {
+                bufs[pos]->i += sent;
+                break;
+            }
+            bufs[pos]->i = bufs[pos]->b.end();
+            sent -= sz;
+            ++pos;
+        }
+    }
+}
+#endif
+
 #if defined(ICE_USE_IOCP)
 AsyncInfo*
 StreamSocket::getAsyncInfo(SocketOperation op)
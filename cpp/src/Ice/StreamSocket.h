@@ -35,6 +35,10 @@ public:
     ssize_t read(char*, size_t);
     ssize_t write(const char*, size_t);
 
+#if !defined(ICE_USE_IOCP)
+    SocketOperation writev(const std::vector<Buffer*>&);
+#endif
+
 #if defined(ICE_USE_IOCP)
     AsyncInfo* getAsyncInfo(SocketOperation);
 #endif
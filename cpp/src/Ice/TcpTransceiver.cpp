@@ -49,6 +49,14 @@ IceInternal::TcpTransceiver::write(Buffer& buf)
     return _stream->write(buf);
 }
 
+#if !defined(ICE_USE_IOCP)
+SocketOperation
+IceInternal::TcpTransceiver::writev(const vector<Buffer*>& bufs)
+{
+    return _stream->writev(bufs);
+}
+#endif
+
 SocketOperation
 IceInternal::TcpTransceiver::read(Buffer& buf)
 {
@@ -30,6 +30,9 @@ public:
     void close() final;
     SocketOperation write(Buffer&) final;
     SocketOperation read(Buffer&) final;
+#if !defined(ICE_USE_IOCP)
+    SocketOperation writev(const std::vector<Buffer*>&) final;
+#endif
 #if defined(ICE_USE_IOCP)
     bool startWrite(Buffer&) final;
     void finishWrite(Buffer&) final;
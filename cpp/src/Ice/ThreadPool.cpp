@@ -7,16 +7,28 @@
 #include <Ice/Network.h>
 #include <Ice/LocalException.h>
 #include <Ice/Instance.h>
+#include <Ice/BufferPool.h>
 #include <Ice/LoggerUtil.h>
 #include <Ice/Protocol.h>
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/Properties.h>
 #include <Ice/TraceLevels.h>
+#include <IceUtil/StringUtil.h>
 
 #if defined(__FreeBSD__)
 #   include <sys/sysctl.h>
 #endif
 
+#if defined(__linux__)
+#   include <algorithm>
+#   include <fstream>
+#   include <iterator>
+#   include <pthread.h>
+#   include <sched.h>
+#   include <sys/syscall.h>
+#   include <linux/mempolicy.h>
+#endif
+
 using namespace std;
 using namespace Ice;
 using namespace Ice::Instrumentation;
@@ -109,6 +121,86 @@ class ThreadPoolDestroyedException
 {
 };
 
+//
+// The work stealing executor and queue of the calling thread, if it's a
+// worker thread or a thread of a thread pool with work stealing enabled.
+//
+thread_local WorkStealingExecutor* currentExecutor = nullptr;
+thread_local WorkStealingQueue* currentQueue = nullptr;
+
+#if defined(__linux__)
+const int maxNumaNodes = 1024; // Size in bits of the node mask passed to set_mempolicy.
+
+//
+// Parses a CPU number, returns -1 if the string isn't a valid CPU number.
+//
+int
+parseCpu(const string& str)
+{
+    if(str.empty() || str.size() > 4 || str.find_first_not_of("0123456789") != string::npos)
+    {
+        return -1;
+    }
+    int cpu = atoi(str.c_str());
+    return cpu < CPU_SETSIZE ? cpu : -1;
+}
+
+//
+// Parses a list of CPUs in the format used by Linux, for example "0-3,8,10-11".
+//
+bool
+parseCpuList(const string& str, set<int>& cpus)
+{
+    vector<string> ranges;
+    if(!IceUtilInternal::splitString(str, ",", ranges) || ranges.empty())
+    {
+        return false;
+    }
+    for(const auto& range : ranges)
+    {
+        string::size_type pos = range.find('-');
+        int first = parseCpu(IceUtilInternal::trim(range.substr(0, pos)));
+        int last = pos == string::npos ? first : parseCpu(IceUtilInternal::trim(range.substr(pos + 1)));
+        if(first < 0 || last < first)
+        {
+            return false;
+        }
+        for(int cpu = first; cpu <= last; ++cpu)
+        {
+            cpus.insert(cpu);
+        }
+    }
+    return true;
+}
+
+//
+// Gets the CPUs of a NUMA node, returns false if the node doesn't exist.
+//
+bool
+getNumaNodeCpus(int node, set<int>& cpus)
+{
+    if(node >= maxNumaNodes)
+    {
+        return false;
+    }
+    ifstream is("/sys/devices/system/node/node" + to_string(node) + "/cpulist");
+    string line;
+    return is && getline(is, line) && parseCpuList(IceUtilInternal::trim(line), cpus);
+}
+#endif
+
+#if !defined(ICE_USE_IOCP)
+inline void
+cpuRelax()
+{
+#   if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#   elif defined(__aarch64__)
+    asm volatile("yield");
+#   endif
+}
+#endif
+
 #ifdef ICE_SWIFT
 string
 prefixToDispatchQueueLabel(const std::string& prefix)
@@ -159,6 +251,508 @@ IceInternal::DispatchWorkItem::execute(ThreadPoolCurrent& current)
     current.dispatchFromThisThread(shared_from_this());
 }
 
+namespace IceInternal
+{
+
+//
+// A bounded single-producer multiple-consumer queue. Only the thread which owns the queue
+// adds work items, any thread can take them in FIFO order. Work items added when the queue
+// is full are kept in an overflow list protected by a mutex, which is used until it's empty
+// again to preserve the order of the work items.
+//
+class WorkStealingQueue
+{
+public:
+
+    WorkStealingQueue() : _top(0), _bottom(0), _overflowed(false), _owned(false)
+    {
+        for(auto& p : _items)
+        {
+            p.store(nullptr, memory_order_relaxed);
+        }
+    }
+
+    ~WorkStealingQueue()
+    {
+        while(take())
+        {
+        }
+    }
+
+    bool acquire()
+    {
+        bool owned = false;
+        return _owned.compare_exchange_strong(owned, true);
+    }
+
+    void release()
+    {
+        _owned.store(false);
+    }
+
+    void push(const DispatchWorkItemPtr& workItem)
+    {
+        if(_overflowed.load(memory_order_acquire))
+        {
+            lock_guard lock(_mutex);
+            if(!_overflow.empty())
+            {
+                _overflow.push_back(workItem);
+                return;
+            }
+        }
+
+        int64_t b = _bottom.load(memory_order_relaxed);
+        int64_t t = _top.load(memory_order_acquire);
+        if(b - t >= capacity)
+        {
+            lock_guard lock(_mutex);
+            _overflow.push_back(workItem);
+            _overflowed.store(true, memory_order_release);
+            return;
+        }
+        _items[b & (capacity - 1)].store(new DispatchWorkItemPtr(workItem), memory_order_relaxed);
+        _bottom.store(b + 1, memory_order_release);
+    }
+
+    DispatchWorkItemPtr take()
+    {
+        while(true)
+        {
+            int64_t t = _top.load(memory_order_acquire);
+            atomic_thread_fence(memory_order_seq_cst);
+            int64_t b = _bottom.load(memory_order_acquire);
+            if(t >= b)
+            {
+                break;
+            }
+
+            //
+            // The slot can't be reused by the owner before _top is incremented, if another
+            // thread took the work item first the compare and exchange fails and we retry.
+            //
+            DispatchWorkItemPtr* p = _items[t & (capacity - 1)].load(memory_order_relaxed);
+            if(_top.compare_exchange_weak(t, t + 1, memory_order_seq_cst, memory_order_relaxed))
+            {
+                DispatchWorkItemPtr workItem = std::move(*p);
+                delete p;
+                return workItem;
+            }
+        }
+
+        if(_overflowed.load(memory_order_acquire))
+        {
+            lock_guard lock(_mutex);
+            if(!_overflow.empty())
+            {
+                DispatchWorkItemPtr workItem = _overflow.front();
+                _overflow.pop_front();
+                if(_overflow.empty())
+                {
+                    _overflowed.store(false, memory_order_release);
+                }
+                return workItem;
+            }
+        }
+        return nullptr;
+    }
+
+    bool empty() const
+    {
+        return _top.load(memory_order_acquire) >= _bottom.load(memory_order_acquire) &&
+            !_overflowed.load(memory_order_acquire);
+    }
+
+private:
+
+    static const int64_t capacity = 256; // Must be a power of 2.
+
+    alignas(64) atomic<int64_t> _top;
+    alignas(64) atomic<int64_t> _bottom;
+    atomic<DispatchWorkItemPtr*> _items[capacity];
+    mutex _mutex;
+    deque<DispatchWorkItemPtr> _overflow;
+    atomic<bool> _overflowed;
+    atomic<bool> _owned;
+};
+
+class WorkStealingExecutor::WorkerThread final : public IceUtil::Thread
+{
+public:
+
+    WorkerThread(WorkStealingExecutor& executor, size_t index, const string& name) :
+        IceUtil::Thread(name),
+        _executor(executor),
+        _index(index),
+        _state(ThreadState::ThreadStateIdle)
+    {
+        updateObserver();
+    }
+
+    void run() final;
+
+    void updateObserver()
+    {
+        const CommunicatorObserverPtr& obsv = _executor._threadPool._instance->initializationData().observer;
+        if(obsv)
+        {
+            lock_guard lock(_mutex);
+            _observer.attach(obsv->getThreadObserver(_executor._threadPool._prefix, name(), _state, _observer.get()));
+        }
+    }
+
+    void setState(ThreadState s)
+    {
+        if(_executor._threadPool._instance->initializationData().observer)
+        {
+            lock_guard lock(_mutex);
+            if(_observer && _state != s)
+            {
+                _observer->stateChanged(_state, s);
+            }
+            _state = s;
+        }
+    }
+
+private:
+
+    WorkStealingExecutor& _executor;
+    const size_t _index;
+    ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+    ThreadState _state;
+    mutex _mutex;
+};
+
+}
+
+void
+IceInternal::WorkStealingExecutor::WorkerThread::run()
+{
+    _executor._threadPool.setAffinity();
+
+    const InitializationData& initData = _executor._threadPool._instance->initializationData();
+    if(initData.threadStart)
+    {
+        try
+        {
+            initData.threadStart();
+        }
+        catch(const exception& ex)
+        {
+            Error out(initData.logger);
+            out << "thread hook start() method raised an unexpected exception in `" << _executor._threadPool._prefix
+                << "':\n" << ex;
+        }
+        catch(...)
+        {
+            Error out(initData.logger);
+            out << "thread hook start() method raised an unexpected exception in `" << _executor._threadPool._prefix
+                << "'";
+        }
+    }
+
+    currentExecutor = &_executor;
+    currentQueue = _executor._queues[_index].get();
+    _executor.run(_index, *this);
+    currentExecutor = nullptr;
+    currentQueue = nullptr;
+
+    _observer.detach();
+
+    if(initData.threadStop)
+    {
+        try
+        {
+            initData.threadStop();
+        }
+        catch(const exception& ex)
+        {
+            Error out(initData.logger);
+            out << "thread hook stop() method raised an unexpected exception in `" << _executor._threadPool._prefix
+                << "':\n" << ex;
+        }
+        catch(...)
+        {
+            Error out(initData.logger);
+            out << "thread hook stop() method raised an unexpected exception in `" << _executor._threadPool._prefix
+                << "'";
+        }
+    }
+}
+
+IceInternal::WorkStealingExecutor::WorkStealingExecutor(ThreadPool& threadPool, int size) :
+    _threadPool(threadPool),
+    _size(size),
+    _destroyed(false),
+    _producers(0),
+    _sleeping(0),
+    _sharedSize(0)
+{
+    //
+    // A queue for each worker thread and for each thread of the thread pool.
+    //
+    for(int i = 0; i < _size + _threadPool._sizeMax; ++i)
+    {
+        _queues.push_back(make_unique<WorkStealingQueue>());
+        if(i < _size)
+        {
+            _queues.back()->acquire();
+        }
+    }
+}
+
+IceInternal::WorkStealingExecutor::~WorkStealingExecutor()
+{
+}
+
+void
+IceInternal::WorkStealingExecutor::start()
+{
+    if(_threadPool._instance->traceLevels()->threadPool >= 1)
+    {
+        Trace out(_threadPool._instance->initializationData().logger,
+                  _threadPool._instance->traceLevels()->threadPoolCat);
+        out << "creating work stealing executor for " << _threadPool._prefix << ": Size = " << _size;
+    }
+
+    for(int i = 0; i < _size; ++i)
+    {
+        ostringstream os;
+        os << _threadPool._prefix << "-dispatch-" << i;
+        auto thread = make_shared<WorkerThread>(*this, static_cast<size_t>(i), os.str());
+        if(_threadPool._hasPriority)
+        {
+            thread->start(_threadPool._stackSize, _threadPool._priority);
+        }
+        else
+        {
+            thread->start(_threadPool._stackSize);
+        }
+        _threads.push_back(thread);
+    }
+}
+
+void
+IceInternal::WorkStealingExecutor::destroy()
+{
+    _destroyed.store(true);
+    lock_guard lock(_mutex);
+    _conditionVariable.notify_all();
+}
+
+void
+IceInternal::WorkStealingExecutor::joinWithAllThreads()
+{
+    for(const auto& thread : _threads)
+    {
+        thread->getThreadControl().join();
+    }
+}
+
+void
+IceInternal::WorkStealingExecutor::updateObservers()
+{
+    for(const auto& thread : _threads)
+    {
+        thread->updateObserver();
+    }
+}
+
+void
+IceInternal::WorkStealingExecutor::attach()
+{
+    //
+    // Called by a thread of the thread pool when it starts. If all the queues are in use, the
+    // work items it dispatches are queued on the shared queue.
+    //
+    for(size_t i = static_cast<size_t>(_size); i < _queues.size(); ++i)
+    {
+        if(_queues[i]->acquire())
+        {
+            currentExecutor = this;
+            currentQueue = _queues[i].get();
+            return;
+        }
+    }
+}
+
+void
+IceInternal::WorkStealingExecutor::detach()
+{
+    //
+    // The work items left in the queue are still taken by the worker threads.
+    //
+    if(currentExecutor == this)
+    {
+        currentQueue->release();
+        currentExecutor = nullptr;
+        currentQueue = nullptr;
+    }
+}
+
+void
+IceInternal::WorkStealingExecutor::execute(const DispatchWorkItemPtr& workItem)
+{
+    //
+    // The producer count prevents the worker threads from terminating while a work item
+    // is being queued after the destroyed flag was checked.
+    //
+    _producers.fetch_add(1);
+    if(_destroyed.load())
+    {
+        _producers.fetch_sub(1);
+        wakeUp();
+        throw CommunicatorDestroyedException(__FILE__, __LINE__);
+    }
+
+    if(currentExecutor == this)
+    {
+        currentQueue->push(workItem);
+    }
+    else
+    {
+        lock_guard lock(_mutex);
+        _shared.push_back(workItem);
+        _sharedSize.store(_shared.size(), memory_order_release);
+    }
+    _producers.fetch_sub(1);
+    wakeUp();
+}
+
+void
+IceInternal::WorkStealingExecutor::run(size_t index, WorkerThread& thread)
+{
+    unsigned int count = 0;
+    while(true)
+    {
+        DispatchWorkItemPtr workItem = next(index, ++count);
+        if(workItem)
+        {
+            thread.setState(ThreadState::ThreadStateInUseForUser);
+            try
+            {
+                _threadPool.dispatchFromThisThread(workItem);
+            }
+            catch(const exception& ex)
+            {
+                Error out(_threadPool._instance->initializationData().logger);
+                out << "exception in `" << _threadPool._prefix << "':\n" << ex;
+            }
+            catch(...)
+            {
+                Error out(_threadPool._instance->initializationData().logger);
+                out << "exception in `" << _threadPool._prefix << "'";
+            }
+            thread.setState(ThreadState::ThreadStateIdle);
+            continue;
+        }
+
+        unique_lock lock(_mutex);
+        _sleeping.fetch_add(1);
+        atomic_thread_fence(memory_order_seq_cst);
+        if(!hasWork())
+        {
+            if(_destroyed.load() && _producers.load() == 0)
+            {
+                _sleeping.fetch_sub(1);
+                return;
+            }
+            _conditionVariable.wait(lock);
+        }
+        _sleeping.fetch_sub(1);
+    }
+}
+
+DispatchWorkItemPtr
+IceInternal::WorkStealingExecutor::next(size_t index, unsigned int count)
+{
+    //
+    // Check the shared queue first from time to time to ensure its work items are executed
+    // even if the worker threads keep dispatching work items.
+    //
+    DispatchWorkItemPtr workItem;
+    if(count % 61 == 0)
+    {
+        workItem = nextShared();
+    }
+
+    if(!workItem)
+    {
+        workItem = _queues[index]->take();
+    }
+
+    if(!workItem)
+    {
+        workItem = nextShared();
+    }
+
+    for(size_t i = 1; !workItem && i < _queues.size(); ++i)
+    {
+        workItem = _queues[(index + i) % _queues.size()]->take();
+    }
+    return workItem;
+}
+
+DispatchWorkItemPtr
+IceInternal::WorkStealingExecutor::nextShared()
+{
+    if(_sharedSize.load(memory_order_acquire) == 0)
+    {
+        return nullptr;
+    }
+
+    lock_guard lock(_mutex);
+    if(_shared.empty())
+    {
+        return nullptr;
+    }
+    DispatchWorkItemPtr workItem = _shared.front();
+    _shared.pop_front();
+    _sharedSize.store(_shared.size(), memory_order_release);
+    return workItem;
+}
+
+bool
+IceInternal::WorkStealingExecutor::hasWork() const
+{
+    // Must be called with _mutex locked.
+    if(!_shared.empty())
+    {
+        return true;
+    }
+
+    for(const auto& queue : _queues)
+    {
+        if(!queue->empty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+IceInternal::WorkStealingExecutor::wakeUp()
+{
+    //
+    // The fence orders the queuing of the work item with the load of the sleeping thread
+    // count, a worker thread going to sleep increments the count before checking the queues.
+    //
+    atomic_thread_fence(memory_order_seq_cst);
+    if(_sleeping.load(memory_order_relaxed) > 0)
+    {
+        lock_guard lock(_mutex);
+        if(_destroyed.load())
+        {
+            _conditionVariable.notify_all();
+        }
+        else
+        {
+            _conditionVariable.notify_one();
+        }
+    }
+}
+
 IceInternal::ThreadPoolWorkQueue::ThreadPoolWorkQueue(ThreadPool& threadPool) :
     _threadPool(threadPool),
     _destroyed(false)
@@ -295,9 +889,16 @@ IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, const string& p
     _serverIdleTime(timeout),
     _threadIdleTime(0),
     _stackSize(0),
+    _busyPoll(0),
+    _busyPollThreads(0),
+    _numaNode(-1),
+    _pinThreads(false),
+    _nextCpu(0),
     _inUse(0),
 #if !defined(ICE_USE_IOCP)
     _inUseIO(0),
+    _spinning(0),
+    _signals(0),
     _nextHandler(_handlers.end()),
 #endif
     _promote(true)
@@ -387,6 +988,44 @@ IceInternal::ThreadPool::initialize()
     _selector.setup(_sizeIO);
 #endif
 
+    if(properties->getPropertyAsInt(_prefix + ".IoUring") > 0)
+    {
+#if defined(ICE_HAS_IO_URING)
+        try
+        {
+            _selector.setupIoUring(256);
+        }
+        catch(const Ice::LocalException& ex)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "couldn't enable io_uring for `" << _prefix << "', using epoll instead:\n" << ex;
+        }
+#else
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".IoUring is not supported on this platform";
+#endif
+    }
+
+    int busyPoll = properties->getPropertyAsInt(_prefix + ".BusyPoll");
+    if(busyPoll > 0)
+    {
+#if defined(ICE_USE_IOCP) || defined(ICE_USE_CFSTREAM)
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".BusyPoll is not supported on this platform";
+#else
+        int busyPollThreads = properties->getPropertyAsIntWithDefault(_prefix + ".BusyPollThreads", 1);
+        if(busyPollThreads < 1)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << _prefix << ".BusyPollThreads < 1; BusyPollThreads adjusted to 1";
+            busyPollThreads = 1;
+        }
+        const_cast<int&>(_busyPoll) = busyPoll;
+        const_cast<int&>(_busyPollThreads) = busyPollThreads;
+        _selector.setupBusyPoll(busyPoll);
+#endif
+    }
+
 #if defined(__APPLE__)
     //
     // We use a default stack size of 1MB on macOS and the new C++11 mapping to allow transmitting
@@ -413,9 +1052,104 @@ IceInternal::ThreadPool::initialize()
         const_cast<int&>(_priority) = properties->getPropertyAsInt("Ice.ThreadPriority");
     }
 
+    string cpuAffinity = properties->getProperty(_prefix + ".CpuAffinity");
+    int numaNode = properties->getPropertyAsIntWithDefault(_prefix + ".NumaNode", -1);
+    bool pinThreads = properties->getPropertyAsInt(_prefix + ".PinThreads") > 0;
+    if(!cpuAffinity.empty() || numaNode >= 0 || pinThreads)
+    {
+#if defined(__linux__)
+        set<int> cpus;
+        if(!cpuAffinity.empty() && !parseCpuList(cpuAffinity, cpus))
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "invalid CPU list `" << cpuAffinity << "' for " << _prefix << ".CpuAffinity; CpuAffinity ignored";
+            cpus.clear();
+        }
+
+        const long cpuCount = sysconf(_SC_NPROCESSORS_CONF);
+        for(auto p = cpus.begin(); p != cpus.end();)
+        {
+            if(cpuCount > 0 && *p >= cpuCount)
+            {
+                Warning out(_instance->initializationData().logger);
+                out << _prefix << ".CpuAffinity: CPU " << *p << " doesn't exist; CPU ignored";
+                p = cpus.erase(p);
+            }
+            else
+            {
+                ++p;
+            }
+        }
+
+        if(numaNode >= 0)
+        {
+            set<int> nodeCpus;
+            if(!getNumaNodeCpus(numaNode, nodeCpus))
+            {
+                Warning out(_instance->initializationData().logger);
+                out << _prefix << ".NumaNode: NUMA node " << numaNode << " doesn't exist; NumaNode ignored";
+                numaNode = -1;
+            }
+            else if(cpus.empty())
+            {
+                cpus = nodeCpus;
+            }
+            else
+            {
+                set<int> localCpus;
+                set_intersection(cpus.begin(), cpus.end(), nodeCpus.begin(), nodeCpus.end(),
+                                 inserter(localCpus, localCpus.begin()));
+                if(localCpus.empty())
+                {
+                    Warning out(_instance->initializationData().logger);
+                    out << _prefix << ".CpuAffinity: none of the CPUs are on NUMA node " << numaNode
+                        << "; CpuAffinity ignored";
+                    localCpus = nodeCpus;
+                }
+                cpus = localCpus;
+            }
+        }
+
+        if(cpus.empty() && pinThreads)
+        {
+            //
+            // Pin the threads to the CPUs the process is allowed to run on.
+            //
+            cpu_set_t cpuSet;
+            if(sched_getaffinity(0, sizeof(cpuSet), &cpuSet) == 0)
+            {
+                for(int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+                {
+                    if(CPU_ISSET(cpu, &cpuSet))
+                    {
+                        cpus.insert(cpu);
+                    }
+                }
+            }
+        }
+
+        const_cast<vector<int>&>(_cpus).assign(cpus.begin(), cpus.end());
+        const_cast<int&>(_numaNode) = numaNode;
+        const_cast<bool&>(_pinThreads) = pinThreads && !_cpus.empty();
+#else
+        Warning out(_instance->initializationData().logger);
+        out << _prefix << ".CpuAffinity, " << _prefix << ".NumaNode and " << _prefix
+            << ".PinThreads are not supported on this platform";
+#endif
+    }
+
     _workQueue = make_shared<ThreadPoolWorkQueue>(*this);
     _selector.initialize(_workQueue.get());
 
+    //
+    // Work stealing is only used when the thread pool can have several threads, a thread pool
+    // with a single thread executes its dispatch work items one after the other with its thread.
+    //
+    if(properties->getPropertyAsInt(_prefix + ".WorkStealing") > 0 && _sizeMax > 1)
+    {
+        _executor = make_unique<WorkStealingExecutor>(*this, _sizeMax);
+    }
+
     if(_instance->traceLevels()->threadPool >= 1)
     {
         Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
@@ -425,6 +1159,11 @@ IceInternal::ThreadPool::initialize()
 
     try
     {
+        if(_executor)
+        {
+            _executor->start();
+        }
+
         for(int i = 0 ; i < _size ; ++i)
         {
             auto thread = make_shared<EventHandlerThread>(shared_from_this(), nextThreadId());
@@ -470,6 +1209,10 @@ IceInternal::ThreadPool::destroy()
     }
     _destroyed = true;
     _workQueue->destroy();
+    if(_executor)
+    {
+        _executor->destroy();
+    }
 }
 
 void
@@ -480,6 +1223,10 @@ IceInternal::ThreadPool::updateObservers()
     {
         (*p)->updateObserver();
     }
+    if(_executor)
+    {
+        _executor->updateObservers();
+    }
 }
 
 void
@@ -614,6 +1361,12 @@ IceInternal::ThreadPool::dispatchFromThisThread(const DispatchWorkItemPtr& workI
 void
 IceInternal::ThreadPool::dispatch(const DispatchWorkItemPtr& workItem)
 {
+    if(_executor)
+    {
+        _executor->execute(workItem);
+        return;
+    }
+
     lock_guard lock(_mutex);
     if(_destroyed)
     {
@@ -663,6 +1416,10 @@ IceInternal::ThreadPool::joinWithAllThreads()
     {
         (*p)->getThreadControl().join();
     }
+    if(_executor)
+    {
+        _executor->joinWithAllThreads();
+    }
     _selector.destroy();
 }
 
@@ -724,6 +1481,10 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
             catch(const SelectorTimeoutException&)
             {
                 lock_guard lock(_mutex);
+                if(_busyPoll > 0)
+                {
+                    thread->busyPoll(_selector.spinTime(), _selector.blockedTime());
+                }
                 if(!_destroyed && _inUse == 0)
                 {
                     _workQueue->queue(make_shared<ShutdownWorkItem>(_instance)); // Select timed-out.
@@ -738,6 +1499,10 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
             {
                 if(select)
                 {
+                    if(_busyPoll > 0)
+                    {
+                        thread->busyPoll(_selector.spinTime(), _selector.blockedTime());
+                    }
                     _selector.finishSelect(_handlers);
                     _nextHandler = _handlers.begin();
                     select = false;
@@ -973,7 +1738,7 @@ IceInternal::ThreadPool::ioCompleted(ThreadPoolCurrent& current)
         }
         else if(_promote && (_nextHandler != _handlers.end() || _inUseIO == 0))
         {
-            _conditionVariable.notify_one();
+            signalFollower();
         }
 #endif
 
@@ -1136,11 +1901,25 @@ IceInternal::ThreadPool::promoteFollower(ThreadPoolCurrent& current)
     _promote = true;
     if(_inUseIO < _sizeIO && (_nextHandler != _handlers.end() || _inUseIO == 0))
     {
-        _conditionVariable.notify_one();
+        signalFollower();
     }
     current._leader = false;
 }
 
+void
+IceInternal::ThreadPool::signalFollower()
+{
+    //
+    // A follower polling for its promotion doesn't need to be woken up, it
+    // checks the promotion condition once it sees the signal.
+    //
+    _signals.fetch_add(1, memory_order_relaxed);
+    if(_spinning == 0)
+    {
+        _conditionVariable.notify_one();
+    }
+}
+
 bool
 IceInternal::ThreadPool::followerWait(ThreadPoolCurrent& current, unique_lock<mutex>& lock)
 {
@@ -1158,10 +1937,19 @@ IceInternal::ThreadPool::followerWait(ThreadPoolCurrent& current, unique_lock<mu
     current.stream.b.clear();
 
     //
-    // Wait to be promoted and for all the IO threads to be done.
+    // Wait to be promoted and for all the IO threads to be done. With busy
+    // polling, the follower first polls for a signal and only waits on the
+    // condition variable if it's not signaled within the busy poll time.
     //
+    bool spin = _busyPoll > 0;
     while(!_promote || _inUseIO == _sizeIO || (_nextHandler == _handlers.end() && _inUseIO > 0))
     {
+        if(spin && _spinning < _busyPollThreads - 1)
+        {
+            spin = followerSpin(current, lock);
+            continue;
+        }
+
         if(_threadIdleTime)
         {
             if(_conditionVariable.wait_for(lock, chrono::seconds(_threadIdleTime)) != cv_status::no_timeout)
@@ -1190,7 +1978,86 @@ IceInternal::ThreadPool::followerWait(ThreadPoolCurrent& current, unique_lock<mu
     _promote = false;
     return false;
 }
+
+bool
+IceInternal::ThreadPool::followerSpin(ThreadPoolCurrent& current, unique_lock<mutex>& lock)
+{
+    //
+    // Must be called with the thread pool mutex locked. Returns true if the
+    // follower was signaled, the promotion condition must be checked again
+    // since the signal might have been for another follower.
+    //
+    ++_spinning;
+    unsigned int signals = _signals.load(memory_order_relaxed);
+    lock.unlock();
+
+    auto start = chrono::steady_clock::now();
+    bool signaled = false;
+    do
+    {
+        for(int i = 0; i < 64 && !signaled; ++i)
+        {
+            cpuRelax();
+            signaled = _signals.load(memory_order_relaxed) != signals;
+        }
+    }
+    while(!signaled && chrono::steady_clock::now() - start < chrono::microseconds(_busyPoll));
+    int64_t spinTime = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+
+    lock.lock();
+    --_spinning;
+    current._thread->busyPoll(spinTime, 0);
+    return signaled;
+}
+#endif
+
+void
+IceInternal::ThreadPool::setAffinity()
+{
+#if defined(__linux__)
+    if(_numaNode >= 0)
+    {
+        //
+        // Allocate the memory of the calling thread from the NUMA node when possible, the buffers of the
+        // connections handled by this thread pool then stay local to the CPUs that read and dispatch their
+        // messages.
+        //
+        unsigned long nodeMask[maxNumaNodes / (8 * sizeof(unsigned long))] = {};
+        nodeMask[static_cast<size_t>(_numaNode) / (8 * sizeof(unsigned long))] |=
+            1UL << (static_cast<size_t>(_numaNode) % (8 * sizeof(unsigned long)));
+        if(syscall(SYS_set_mempolicy, MPOL_PREFERRED, nodeMask, maxNumaNodes) != 0)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "couldn't set the memory policy of a thread of `" << _prefix << "':\n"
+                << IceUtilInternal::lastErrorToString();
+        }
+    }
+
+    if(!_cpus.empty())
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        if(_pinThreads)
+        {
+            CPU_SET(_cpus[_nextCpu++ % _cpus.size()], &cpuSet);
+        }
+        else
+        {
+            for(int cpu : _cpus)
+            {
+                CPU_SET(cpu, &cpuSet);
+            }
+        }
+        int err = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+        if(err != 0)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << "couldn't set the CPU affinity of a thread of `" << _prefix << "':\n"
+                << IceUtilInternal::errorToString(err);
+        }
+    }
 #endif
+}
 
 string
 IceInternal::ThreadPool::nextThreadId()
@@ -1229,13 +2096,41 @@ IceInternal::ThreadPool::EventHandlerThread::setState(Ice::Instrumentation::Thre
         {
             _observer->stateChanged(_state, s);
         }
+
+        //
+        // Report the buffer pool allocations of this thread since the last
+        // state change.
+        //
+        BufferPool* bufferPool = _pool->_instance->bufferPool();
+        if(bufferPool)
+        {
+            int hits;
+            int misses;
+            bufferPool->takeStats(hits, misses);
+            if(hits > 0 || misses > 0)
+            {
+                _observer->bufferPool(hits, misses);
+            }
+        }
     }
     _state = s;
 }
 
+void
+IceInternal::ThreadPool::EventHandlerThread::busyPoll(int64_t spinTime, int64_t blockedTime)
+{
+    // Must be called with the thread pool mutex locked
+    if(_observer)
+    {
+        _observer->busyPoll(spinTime, blockedTime);
+    }
+}
+
 void
 IceInternal::ThreadPool::EventHandlerThread::run()
 {
+    _pool->setAffinity();
+
     if(_pool->_instance->initializationData().threadStart)
     {
         try
@@ -1254,6 +2149,11 @@ IceInternal::ThreadPool::EventHandlerThread::run()
         }
     }
 
+    if(_pool->_executor)
+    {
+        _pool->_executor->attach();
+    }
+
     try
     {
         _pool->run(dynamic_pointer_cast<EventHandlerThread>(shared_from_this()));
@@ -1269,6 +2169,11 @@ IceInternal::ThreadPool::EventHandlerThread::run()
         out << "unknown exception in `" << _pool->_prefix << "'";
     }
 
+    if(_pool->_executor)
+    {
+        _pool->_executor->detach();
+    }
+
     _observer.detach();
 
     if(_pool->_instance->initializationData().threadStop)
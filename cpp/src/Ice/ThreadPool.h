@@ -18,6 +18,8 @@
 #include <Ice/InputStream.h>
 #include <Ice/ObserverHelper.h>
 
+#include <atomic>
+#include <deque>
 #include <set>
 #include <list>
 
@@ -29,6 +31,9 @@ class ThreadPoolCurrent;
 class ThreadPoolWorkQueue;
 using ThreadPoolWorkQueuePtr = std::shared_ptr<ThreadPoolWorkQueue>;
 
+class WorkStealingExecutor;
+class WorkStealingQueue;
+
 class ThreadPoolWorkItem
 {
 public:
@@ -72,6 +77,7 @@ class ThreadPool : public std::enable_shared_from_this<ThreadPool>
 
         void updateObserver();
         void setState(Ice::Instrumentation::ThreadState);
+        void busyPoll(std::int64_t, std::int64_t);
 
     private:
 
@@ -130,10 +136,13 @@ private:
     void finishMessage(ThreadPoolCurrent&);
 #else
     void promoteFollower(ThreadPoolCurrent&);
+    void signalFollower();
     bool followerWait(ThreadPoolCurrent&, std::unique_lock<std::mutex>&);
+    bool followerSpin(ThreadPoolCurrent&, std::unique_lock<std::mutex>&);
 #endif
 
     std::string nextThreadId();
+    void setAffinity();
 
     const InstancePtr _instance;
 #ifdef ICE_SWIFT
@@ -147,9 +156,12 @@ private:
     Selector _selector;
     int _nextThreadId;
 
+    std::unique_ptr<WorkStealingExecutor> _executor; // Executes the dispatch work items if work stealing is enabled.
+
     friend class EventHandlerThread;
     friend class ThreadPoolCurrent;
     friend class ThreadPoolWorkQueue;
+    friend class WorkStealingExecutor;
 
     const int _size; // Number of threads that are pre-created.
     const int _sizeIO; // Maximum number of threads that can concurrently perform IO.
@@ -161,11 +173,19 @@ private:
     const int _serverIdleTime;
     const int _threadIdleTime;
     const size_t _stackSize;
+    const int _busyPoll; // Number of microseconds threads poll for events before blocking, 0 if disabled.
+    const int _busyPollThreads; // Maximum number of threads busy polling at the same time.
+    const std::vector<int> _cpus; // CPUs the threads run on, empty if the threads can run on any CPU.
+    const int _numaNode; // NUMA node the threads allocate memory from, -1 if not set.
+    const bool _pinThreads; // True if each thread is pinned to a single CPU from _cpus.
+    std::atomic<unsigned int> _nextCpu; // Index in _cpus of the CPU the next pinned thread runs on.
 
     std::set<EventHandlerThreadPtr> _threads; // All threads, running or not.
     int _inUse; // Number of threads that are currently in use.
 #if !defined(ICE_USE_IOCP)
     int _inUseIO; // Number of threads that are currently performing IO.
+    int _spinning; // Number of followers polling for their promotion.
+    std::atomic<unsigned int> _signals; // Incremented when a follower is signaled.
     std::vector<std::pair<EventHandler*, SocketOperation> > _handlers;
     std::vector<std::pair<EventHandler*, SocketOperation> >::const_iterator _nextHandler;
 #endif
@@ -252,6 +272,55 @@ private:
     std::list<ThreadPoolWorkItemPtr> _workItems;
 };
 
+//
+// The executor for the dispatch work items of a thread pool with the <threadpool>.WorkStealing property set.
+//
+// The dispatch work items are executed by dedicated worker threads instead of going through the work queue of the
+// thread pool. Each worker thread and each thread of the thread pool has its own bounded queue, where it queues the
+// work items it dispatches without locking. A worker thread executes the work items of its own queue in FIFO order
+// and steals work items from the other queues when its own queue is empty. Work items dispatched by other threads
+// are queued on a shared queue.
+//
+class WorkStealingExecutor
+{
+public:
+
+    WorkStealingExecutor(ThreadPool&, int);
+    ~WorkStealingExecutor();
+
+    void start();
+    void destroy();
+    void joinWithAllThreads();
+    void updateObservers();
+
+    void attach();
+    void detach();
+    void execute(const DispatchWorkItemPtr&);
+
+private:
+
+    class WorkerThread;
+    using WorkerThreadPtr = std::shared_ptr<WorkerThread>;
+
+    void run(size_t, WorkerThread&);
+    DispatchWorkItemPtr next(size_t, unsigned int);
+    DispatchWorkItemPtr nextShared();
+    bool hasWork() const;
+    void wakeUp();
+
+    ThreadPool& _threadPool;
+    const int _size;
+    std::vector<std::unique_ptr<WorkStealingQueue>> _queues; // The worker queues followed by the thread pool queues.
+    std::vector<WorkerThreadPtr> _threads;
+    std::atomic<bool> _destroyed;
+    std::atomic<int> _producers; // The number of threads queuing a work item.
+    std::atomic<int> _sleeping; // The number of worker threads waiting for work items.
+    std::atomic<size_t> _sharedSize;
+    std::deque<DispatchWorkItemPtr> _shared;
+    std::mutex _mutex;
+    std::condition_variable _conditionVariable;
+};
+
 //
 // The ThreadPoolMessage class below hides the IOCP implementation details from
 // the event handler implementations. Only event handler implementation that
@@ -6,10 +6,366 @@
 #include <IceUtil/Exception.h>
 #include <Ice/ConsoleUtil.h>
 
+#include <limits>
+#include <list>
+#include <unordered_map>
+
 using namespace std;
 using namespace IceUtil;
 using namespace IceInternal;
 
+//
+// A hierarchical timing wheel: the tasks are kept in 4 levels of 256 slots.
+// Each slot of the first level holds the tasks that expire at a given 1ms
+// tick in the next 256 ticks, and each slot of the next levels covers 256
+// times the ticks of a slot of the previous level. When the first level
+// wraps around, the tasks of the next slot of the second level are moved
+// down to the slots of the first level, and so on. Scheduling and cancelling
+// a task are constant time operations, and a task never executes before its
+// scheduled time.
+//
+class Timer::Wheel
+{
+public:
+
+    Wheel(Timer&);
+
+    void schedule(const TimerTaskPtr&, chrono::steady_clock::time_point, optional<chrono::nanoseconds>);
+    bool cancel(const TimerTaskPtr&);
+    void destroy();
+    void join();
+
+private:
+
+    struct Entry;
+    using Slot = list<Entry>;
+
+    struct Entry
+    {
+        TimerTaskPtr task;
+        optional<chrono::nanoseconds> delay;
+        uint64_t tick; // The tick at which the task expires.
+        Slot* slot; // The slot holding this entry.
+    };
+
+    static const int levels = 4;
+    static const int slotBits = 8;
+    static const uint64_t slotMask = (1 << slotBits) - 1;
+
+    uint64_t toTick(chrono::steady_clock::time_point) const;
+    chrono::steady_clock::time_point toTime(uint64_t) const;
+    Slot& slot(uint64_t);
+    void cascade(int, uint64_t);
+    uint64_t nextTick() const;
+    void run();
+
+    Timer& _timer;
+    const chrono::steady_clock::time_point _start;
+    uint64_t _tick; // The next tick to process, the tasks that expire before this tick have been executed.
+    Slot _slots[levels][slotMask + 1];
+    Slot _running; // The repeated tasks being executed.
+    unordered_map<TimerTaskPtr, Slot::iterator> _tasks;
+    bool _destroyed;
+    chrono::steady_clock::time_point _wakeUpTime;
+    mutex _mutex;
+    condition_variable _condition;
+    thread _worker;
+};
+
+Timer::Wheel::Wheel(Timer& timer) :
+    _timer(timer),
+    _start(chrono::steady_clock::now()),
+    _tick(0),
+    _destroyed(false),
+    _worker(&Wheel::run, this)
+{
+}
+
+void
+Timer::Wheel::schedule(const TimerTaskPtr& task,
+                       chrono::steady_clock::time_point time,
+                       optional<chrono::nanoseconds> delay)
+{
+    lock_guard lock(_mutex);
+    if(_destroyed)
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "timer destroyed");
+    }
+
+    if(_tasks.find(task) != _tasks.end())
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "task is already scheduled");
+    }
+
+    if(_tasks.empty())
+    {
+        //
+        // The wheel is empty, skip the ticks that elapsed since it was last used.
+        //
+        auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - _start);
+        _tick = max(_tick, static_cast<uint64_t>(elapsed.count()));
+    }
+
+    uint64_t tick = toTick(time);
+    Slot& s = slot(tick);
+    s.push_back({ task, delay, tick, &s });
+    _tasks.insert(make_pair(task, prev(s.end())));
+
+    if(_wakeUpTime == chrono::steady_clock::time_point() || toTime(tick) < _wakeUpTime)
+    {
+        _condition.notify_one();
+    }
+}
+
+bool
+Timer::Wheel::cancel(const TimerTaskPtr& task)
+{
+    lock_guard lock(_mutex);
+    if(_destroyed)
+    {
+        return false;
+    }
+
+    auto p = _tasks.find(task);
+    if(p == _tasks.end())
+    {
+        return false;
+    }
+
+    p->second->slot->erase(p->second);
+    _tasks.erase(p);
+    return true;
+}
+
+void
+Timer::Wheel::destroy()
+{
+    lock_guard lock(_mutex);
+    _destroyed = true;
+    _tasks.clear();
+    for(auto& level : _slots)
+    {
+        for(auto& s : level)
+        {
+            s.clear();
+        }
+    }
+    _running.clear();
+    _condition.notify_one();
+}
+
+void
+Timer::Wheel::join()
+{
+    if(this_thread::get_id() == _worker.get_id())
+    {
+        _worker.detach();
+    }
+    else if(_worker.joinable())
+    {
+        _worker.join();
+    }
+}
+
+uint64_t
+Timer::Wheel::toTick(chrono::steady_clock::time_point time) const
+{
+    return static_cast<uint64_t>(chrono::ceil<chrono::milliseconds>(time - _start).count());
+}
+
+chrono::steady_clock::time_point
+Timer::Wheel::toTime(uint64_t tick) const
+{
+    return _start + chrono::milliseconds(tick);
+}
+
+Timer::Wheel::Slot&
+Timer::Wheel::slot(uint64_t tick)
+{
+    //
+    // Tasks that expire beyond the range of the wheel are kept in the last
+    // level, and moved again when their slot is cascaded.
+    //
+    const uint64_t range = uint64_t(1) << (slotBits * levels);
+    uint64_t expires = max(tick, _tick);
+    if(expires - _tick >= range)
+    {
+        expires = _tick + range - 1;
+    }
+
+    int level = 0;
+    while(level < levels - 1 && expires - _tick >= (uint64_t(1) << (slotBits * (level + 1))))
+    {
+        ++level;
+    }
+    return _slots[level][(expires >> (slotBits * level)) & slotMask];
+}
+
+void
+Timer::Wheel::cascade(int level, uint64_t index)
+{
+    Slot pending;
+    pending.swap(_slots[level][index]);
+    while(!pending.empty())
+    {
+        Slot& s = slot(pending.front().tick);
+        pending.front().slot = &s;
+        s.splice(s.end(), pending, pending.begin());
+    }
+}
+
+uint64_t
+Timer::Wheel::nextTick() const
+{
+    //
+    // The next tick with tasks in the first level, or the next tick at which
+    // a slot with tasks of the next levels is cascaded, whichever comes first.
+    //
+    uint64_t next = numeric_limits<uint64_t>::max();
+    for(uint64_t i = 0; i <= slotMask; ++i)
+    {
+        if(!_slots[0][(_tick + i) & slotMask].empty())
+        {
+            next = _tick + i;
+            break;
+        }
+    }
+
+    for(int level = 1; level < levels; ++level)
+    {
+        //
+        // A slot is cascaded at the first tick of its block, the 256 slots of the level are cascaded at the first
+        // ticks of the next 256 blocks, starting with the block of _tick if _tick is its first tick.
+        //
+        const int shift = slotBits * level;
+        const uint64_t first = (_tick + (uint64_t(1) << shift) - 1) >> shift;
+        for(uint64_t i = 0; i <= slotMask; ++i)
+        {
+            uint64_t block = first + i;
+            if((block << shift) >= next)
+            {
+                break;
+            }
+            else if(!_slots[level][block & slotMask].empty())
+            {
+                next = block << shift;
+                break;
+            }
+        }
+    }
+    return next;
+}
+
+void
+Timer::Wheel::run()
+{
+    vector<pair<TimerTaskPtr, bool>> expired;
+    while(true)
+    {
+        {
+            unique_lock lock(_mutex);
+
+            //
+            // Schedule the repeated tasks that just ran again, unless they were canceled.
+            //
+            for(const auto& p : expired)
+            {
+                auto q = _destroyed || !p.second ? _tasks.end() : _tasks.find(p.first);
+                if(q != _tasks.end() && q->second->slot == &_running)
+                {
+                    q->second->tick = toTick(chrono::steady_clock::now() + q->second->delay.value());
+                    Slot& s = slot(q->second->tick);
+                    q->second->slot = &s;
+                    s.splice(s.end(), _running, q->second);
+                }
+            }
+            expired.clear();
+
+            while(!_destroyed && expired.empty())
+            {
+                if(_tasks.empty())
+                {
+                    _wakeUpTime = chrono::steady_clock::time_point();
+                    _condition.wait(lock);
+                    continue;
+                }
+
+                //
+                // Process the ticks with tasks up to the current tick, the ticks without tasks are skipped.
+                //
+                const auto now = chrono::steady_clock::now();
+                const auto elapsed = chrono::duration_cast<chrono::milliseconds>(now - _start);
+                const auto current = static_cast<uint64_t>(elapsed.count());
+                uint64_t next = nextTick();
+                while(next <= current)
+                {
+                    _tick = next;
+                    const uint64_t index = _tick & slotMask;
+                    for(int level = 1; index == 0 && level < levels; ++level)
+                    {
+                        const uint64_t i = (_tick >> (slotBits * level)) & slotMask;
+                        cascade(level, i);
+                        if(i != 0)
+                        {
+                            break;
+                        }
+                    }
+
+                    Slot& s = _slots[0][index];
+                    while(!s.empty())
+                    {
+                        expired.push_back(make_pair(s.front().task, s.front().delay.has_value()));
+                        if(s.front().delay)
+                        {
+                            s.front().slot = &_running;
+                            _running.splice(_running.end(), s, s.begin());
+                        }
+                        else
+                        {
+                            _tasks.erase(s.front().task);
+                            s.pop_front();
+                        }
+                    }
+                    ++_tick;
+                    next = nextTick();
+                }
+                _tick = max(_tick, current + 1);
+
+                if(expired.empty())
+                {
+                    if(next == numeric_limits<uint64_t>::max())
+                    {
+                        _wakeUpTime = chrono::steady_clock::time_point();
+                        _condition.wait(lock);
+                    }
+                    else
+                    {
+                        _wakeUpTime = toTime(next);
+                        _condition.wait_until(lock, _wakeUpTime);
+                    }
+                }
+            }
+
+            if(_destroyed)
+            {
+                break;
+            }
+        }
+
+        for(auto& p : expired)
+        {
+            _timer.execute(p.first);
+            if(!p.second)
+            {
+                //
+                // Clear the reference to the task outside the synchronization, see Timer::run.
+                //
+                p.first = nullptr;
+            }
+        }
+    }
+}
+
 TimerTask::~TimerTask()
 {
     // Out of line to avoid weak vtable
@@ -22,6 +378,21 @@ Timer::Timer() :
 {
 }
 
+Timer::Timer(int shards) :
+    _destroyed(false),
+    _wakeUpTime(chrono::steady_clock::time_point())
+{
+    for(int i = 0; i < max(shards, 1); ++i)
+    {
+        _wheels.push_back(make_unique<Wheel>(*this));
+    }
+}
+
+Timer::~Timer()
+{
+    // Out of line because Wheel is an incomplete type in the header
+}
+
 void
 Timer::destroy()
 {
@@ -37,6 +408,16 @@ Timer::destroy()
         _condition.notify_one();
     }
 
+    for(const auto& wheel : _wheels)
+    {
+        wheel->destroy();
+    }
+
+    for(const auto& wheel : _wheels)
+    {
+        wheel->join();
+    }
+
     if (std::this_thread::get_id() == _worker.get_id())
     {
         _worker.detach();
@@ -50,6 +431,11 @@ Timer::destroy()
 bool
 Timer::cancel(const TimerTaskPtr& task)
 {
+    if(!_wheels.empty())
+    {
+        return _wheels[hash<TimerTaskPtr>()(task) / alignof(max_align_t) % _wheels.size()]->cancel(task);
+    }
+
     lock_guard lock(_mutex);
     if(_destroyed)
     {
@@ -68,6 +454,36 @@ Timer::cancel(const TimerTaskPtr& task)
     return true;
 }
 
+void
+Timer::scheduleTask(const TimerTaskPtr& task,
+                    chrono::steady_clock::time_point time,
+                    optional<chrono::nanoseconds> delay)
+{
+    if(!_wheels.empty())
+    {
+        _wheels[hash<TimerTaskPtr>()(task) / alignof(max_align_t) % _wheels.size()]->schedule(task, time, delay);
+        return;
+    }
+
+    lock_guard lock(_mutex);
+    if(_destroyed)
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "timer destroyed");
+    }
+
+    bool inserted = _tasks.insert(make_pair(task, time)).second;
+    if(!inserted)
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "task is already scheduled");
+    }
+    _tokens.insert({ time, delay, task });
+
+    if(_wakeUpTime == chrono::steady_clock::time_point() || time < _wakeUpTime)
+    {
+        _condition.notify_one();
+    }
+}
+
 void Timer::run()
 {
     Token token { chrono::steady_clock::time_point(), nullopt, nullptr };
@@ -130,26 +546,7 @@ void Timer::run()
 
         if (token.task)
         {
-            try
-            {
-                runTimerTask(token.task);
-            }
-            catch(const IceUtil::Exception& e)
-            {
-                consoleErr << "IceUtil::Timer::run(): uncaught exception:\n" << e.what();
-#ifdef __GNUC__
-                consoleErr << "\n" << e.ice_stackTrace();
-#endif
-                consoleErr << endl;
-            }
-            catch(const std::exception& e)
-            {
-                consoleErr << "IceUtil::Timer::run(): uncaught exception:\n" << e.what() << endl;
-            }
-            catch(...)
-            {
-                consoleErr << "IceUtil::Timer::run(): uncaught exception" << endl;
-            }
+            execute(token.task);
 
             if (!token.delay)
             {
@@ -162,6 +559,31 @@ void Timer::run()
     }
 }
 
+void
+Timer::execute(const TimerTaskPtr& task)
+{
+    try
+    {
+        runTimerTask(task);
+    }
+    catch(const IceUtil::Exception& e)
+    {
+        consoleErr << "IceUtil::Timer::run(): uncaught exception:\n" << e.what();
+#ifdef __GNUC__
+        consoleErr << "\n" << e.ice_stackTrace();
+#endif
+        consoleErr << endl;
+    }
+    catch(const std::exception& e)
+    {
+        consoleErr << "IceUtil::Timer::run(): uncaught exception:\n" << e.what() << endl;
+    }
+    catch(...)
+    {
+        consoleErr << "IceUtil::Timer::run(): uncaught exception" << endl;
+    }
+}
+
 void
 Timer::runTimerTask(const TimerTaskPtr& task)
 {
@@ -154,30 +154,53 @@ printHeader(ostream& s, InputStream& stream)
     stream.read(compress);
     s << "\ncompression status = "  << static_cast<int>(compress) << ' ';
 
-    switch(compress)
+    if(type == validateConnectionMsg && compress != 0)
     {
-        case 0:
-        {
-            s << "(not compressed; do not compress response, if any)";
-            break;
-        }
-
-        case 1:
-        {
-            s << "(not compressed; compress response, if any)";
-            break;
-        }
-
-        case 2:
-        {
-            s << "(compressed; compress response, if any)";
-            break;
-        }
-
-        default:
+        //
+        // The compression status of validate connection messages is used
+        // to negotiate the compression codec.
+        //
+        s << "(compression codec negotiation)";
+    }
+    else
+    {
+        switch(compress)
         {
-            s << "(unknown)";
-            break;
+            case 0:
+            {
+                s << "(not compressed; do not compress response, if any)";
+                break;
+            }
+
+            case 1:
+            {
+                s << "(not compressed; compress response, if any)";
+                break;
+            }
+
+            case 2:
+            {
+                s << "(compressed; compress response, if any)";
+                break;
+            }
+
+            case 3:
+            {
+                s << "(compressed with lz4; compress response, if any)";
+                break;
+            }
+
+            case 4:
+            {
+                s << "(compressed with zstd; compress response, if any)";
+                break;
+            }
+
+            default:
+            {
+                s << "(compressed; compress response, if any)";
+                break;
+            }
         }
     }
 
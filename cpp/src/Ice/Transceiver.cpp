@@ -3,6 +3,7 @@
 //
 
 #include <Ice/Transceiver.h>
+#include <Ice/Buffer.h>
 
 using namespace std;
 using namespace Ice;
@@ -14,3 +15,81 @@ IceInternal::Transceiver::bind()
     assert(false);
     return nullptr;
 }
+
+SocketOperation
+IceInternal::Transceiver::writev(const vector<Buffer*>& bufs)
+{
+    for(vector<Buffer*>::const_iterator p = bufs.begin(); p != bufs.end(); ++p)
+    {
+        if((*p)->i != (*p)->b.end())
+        {
+            SocketOperation op = write(**p);
+            if(op)
+            {
+                return op;
+            }
+        }
+    }
+    return SocketOperationNone;
+}
+
+bool
+IceInternal::Transceiver::hasBufferedData() const
+{
+    return false;
+}
+
+SocketOperation
+IceInternal::Transceiver::writeStaged(const vector<Buffer*>& bufs, Buffer& staging, size_t maxSize)
+{
+    //
+    // Helper for transports which can't gather buffers: the remaining bytes of
+    // the first buffers are copied to the staging buffer, up to maxSize bytes,
+    // and written with a single write() call. If a previous call didn't write
+    // the whole staging buffer, it still holds the remaining bytes of the same
+    // buffers and we just continue writing it.
+    //
+    size_t limit = staging.b.empty() ? maxSize : staging.b.size();
+    size_t count = 0;
+    size_t size = 0;
+    for(; count < bufs.size(); ++count)
+    {
+        size_t sz = static_cast<size_t>(bufs[count]->b.end() - bufs[count]->i);
+        if(size + sz > limit)
+        {
+            break;
+        }
+        size += sz;
+    }
+
+    if(staging.b.empty())
+    {
+        if(count < 2)
+        {
+            return Transceiver::writev(bufs); // Nothing to coalesce.
+        }
+
+        staging.b.resize(size);
+        staging.i = staging.b.begin();
+        for(size_t n = 0; n < count; ++n)
+        {
+            staging.i = copy(bufs[n]->i, bufs[n]->b.end(), staging.i);
+        }
+        staging.i = staging.b.begin();
+    }
+    assert(size == staging.b.size());
+
+    SocketOperation op = write(staging);
+    if(staging.i != staging.b.end())
+    {
+        return op;
+    }
+
+    for(size_t n = 0; n < count; ++n)
+    {
+        bufs[n]->i = bufs[n]->b.end();
+    }
+    staging.b.resize(0);
+    staging.i = staging.b.begin();
+    return op ? op : Transceiver::writev(bufs);
+}
@@ -10,6 +10,8 @@
 #include <Ice/EndpointIF.h>
 #include <Ice/Network.h>
 
+#include <vector>
+
 namespace IceInternal
 {
 
@@ -28,6 +30,21 @@ public:
     virtual EndpointIPtr bind();
     virtual SocketOperation write(Buffer&) = 0;
     virtual SocketOperation read(Buffer&) = 0;
+
+    //
+    // Write the given buffers in order, starting with the first buffer which
+    // isn't fully written. The default implementation calls write() for each
+    // buffer, transports which support gather writes override it to write the
+    // buffers with a single system call.
+    //
+    virtual SocketOperation writev(const std::vector<Buffer*>&);
+
+    //
+    // Return true if the transceiver holds received data which can be read
+    // without a system call. Datagram transceivers which receive several
+    // datagrams at once return true until all of them are read.
+    //
+    virtual bool hasBufferedData() const;
 #if defined(ICE_USE_IOCP)
     virtual bool startWrite(Buffer&) = 0;
     virtual void finishWrite(Buffer&) = 0;
@@ -41,6 +58,10 @@ public:
     virtual Ice::ConnectionInfoPtr getInfo() const = 0;
     virtual void checkSendSize(const Buffer&) = 0;
     virtual void setBufferSize(int, int) = 0;
+
+protected:
+
+    SocketOperation writeStaged(const std::vector<Buffer*>&, Buffer&, size_t);
 };
 
 }
@@ -16,6 +16,24 @@ using namespace std;
 using namespace Ice;
 using namespace IceInternal;
 
+#if defined(ICE_HAS_MMSG)
+namespace
+{
+
+size_t
+getBatchSize(const ProtocolInstancePtr& instance)
+{
+    //
+    // The number of datagrams received or sent with a single system call is
+    // limited by the kernel to UIO_MAXIOV (1024).
+    //
+    int size = instance->properties()->getPropertyAsIntWithDefault("Ice.UDP.BatchSize", 1);
+    return static_cast<size_t>(max(1, min(size, 1024)));
+}
+
+}
+#endif
+
 NativeInfoPtr
 IceInternal::UdpTransceiver::getNativeInfo()
 {
@@ -155,20 +173,7 @@ repeat:
     }
     else
     {
-        socklen_t len = static_cast<socklen_t>(sizeof(sockaddr_storage));
-        if(_peerAddr.saStorage.ss_family == AF_INET)
-        {
-            len = static_cast<socklen_t>(sizeof(sockaddr_in));
-        }
-        else if(_peerAddr.saStorage.ss_family == AF_INET6)
-        {
-            len = static_cast<socklen_t>(sizeof(sockaddr_in6));
-        }
-        else
-        {
-            // No peer has sent a datagram yet.
-            throw SocketException(__FILE__, __LINE__, 0);
-        }
+        socklen_t len = peerAddrLength();
 
 #ifdef _WIN32
         ret = ::sendto(_fd, reinterpret_cast<const char*>(&buf.b[0]), static_cast<int>(buf.b.size()), 0,
@@ -199,6 +204,85 @@ repeat:
     return SocketOperationNone;
 }
 
+SocketOperation
+IceInternal::UdpTransceiver::writev(const vector<Buffer*>& bufs)
+{
+#if defined(ICE_HAS_MMSG)
+    if(_batchSize > 1)
+    {
+        assert(_fd != INVALID_SOCKET && _state >= StateConnected);
+
+        //
+        // Each buffer is sent as a separate datagram, up to _batchSize
+        // datagrams with a single sendmmsg call.
+        //
+        vector<Buffer*>::const_iterator p = bufs.begin();
+        while(p != bufs.end() && (*p)->i == (*p)->b.end())
+        {
+            ++p;
+        }
+
+        vector<Buffer*>::const_iterator first = p;
+        unsigned int count = 0;
+        for(; p != bufs.end() && count < _batchSize; ++p, ++count)
+        {
+            assert((*p)->i == (*p)->b.begin());
+            assert(min(_maxPacketSize, _sndSize - _udpOverhead) >= static_cast<int>((*p)->b.size()));
+            _writeIovs[count].iov_base = &(*p)->b[0];
+            _writeIovs[count].iov_len = (*p)->b.size();
+        }
+
+        if(count < 2)
+        {
+            return Transceiver::writev(bufs);
+        }
+
+        socklen_t len = _state == StateConnected ? 0 : peerAddrLength();
+        for(unsigned int i = 0; i < count; ++i)
+        {
+            memset(&_writeMsgs[i], 0, sizeof(mmsghdr));
+            _writeMsgs[i].msg_hdr.msg_iov = &_writeIovs[i];
+            _writeMsgs[i].msg_hdr.msg_iovlen = 1;
+            if(len > 0)
+            {
+                _writeMsgs[i].msg_hdr.msg_name = &_peerAddr.saStorage;
+                _writeMsgs[i].msg_hdr.msg_namelen = len;
+            }
+        }
+
+    repeat:
+
+        int ret = ::sendmmsg(_fd, &_writeMsgs[0], count, 0);
+        if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                goto repeat;
+            }
+
+            if(wouldBlock())
+            {
+                return SocketOperationWrite;
+            }
+
+            throw SocketException(__FILE__, __LINE__, getSocketErrno());
+        }
+
+        //
+        // If only some of the datagrams were sent, the connection calls us
+        // again for the remaining ones.
+        //
+        for(int i = 0; i < ret; ++i, ++first)
+        {
+            assert(_writeMsgs[static_cast<size_t>(i)].msg_len == (*first)->b.size());
+            (*first)->i = (*first)->b.end();
+        }
+        return SocketOperationNone;
+    }
+#endif
+    return Transceiver::writev(bufs);
+}
+
 SocketOperation
 IceInternal::UdpTransceiver::read(Buffer& buf)
 {
@@ -209,6 +293,13 @@ IceInternal::UdpTransceiver::read(Buffer& buf)
     assert(buf.i == buf.b.begin());
     assert(_fd != INVALID_SOCKET);
 
+#if defined(ICE_HAS_MMSG)
+    if(_batchSize > 1)
+    {
+        return readBatch(buf);
+    }
+#endif
+
 #ifdef _WIN32
     int packetSize = min(_maxPacketSize, _rcvSize - _udpOverhead);
 #else
@@ -279,24 +370,7 @@ repeat:
 
     if(_state == StateNeedConnect)
     {
-        //
-        // If we must connect, we connect to the first peer that sends us a packet.
-        //
-        assert(_incoming); // Client connections should always be connected at this point.
-
-#ifndef NDEBUG
-        bool connected = doConnect(_fd, _peerAddr, Address());
-        assert(connected);
-#else
-        doConnect(_fd, _peerAddr, Address());
-#endif
-        _state = StateConnected;
-
-        if(_instance->traceLevel() >= 1)
-        {
-            Trace out(_instance->logger(), _instance->traceCategory());
-            out << "connected " << _instance->protocol() << " socket\n" << toString();
-        }
+        connectToPeer();
     }
 
     buf.b.resize(static_cast<size_t>(ret));
@@ -304,6 +378,16 @@ repeat:
     return SocketOperationNone;
 }
 
+bool
+IceInternal::UdpTransceiver::hasBufferedData() const
+{
+#if defined(ICE_HAS_MMSG)
+    return _readPos < _readCount;
+#else
+    return false;
+#endif
+}
+
 #if defined(ICE_USE_IOCP)
 bool
 IceInternal::UdpTransceiver::startWrite(Buffer& buf)
@@ -607,6 +691,11 @@ IceInternal::UdpTransceiver::UdpTransceiver(const ProtocolInstancePtr& instance,
     _bound(false),
     _addr(addr),
     _state(StateNeedConnect)
+#if defined(ICE_HAS_MMSG)
+    , _batchSize(getBatchSize(instance)),
+    _readCount(0),
+    _readPos(0)
+#endif
 #if defined(ICE_USE_IOCP)
     , _read(SocketOperationRead),
     _write(SocketOperationWrite)
@@ -615,6 +704,7 @@ IceInternal::UdpTransceiver::UdpTransceiver(const ProtocolInstancePtr& instance,
     _fd = createSocket(true, _addr);
     setBufSize(-1, -1);
     setBlock(_fd, false);
+    initBatch();
 
     _mcastAddr.saStorage.ss_family = AF_UNSPEC;
     _peerAddr.saStorage.ss_family = AF_UNSPEC; // Not initialized yet.
@@ -675,6 +765,11 @@ IceInternal::UdpTransceiver::UdpTransceiver(
     _port(port),
 #endif
     _state(connect ? StateNeedConnect : StateNotConnected)
+#if defined(ICE_HAS_MMSG)
+    , _batchSize(getBatchSize(instance)),
+    _readCount(0),
+    _readPos(0)
+#endif
 #if defined(ICE_USE_IOCP)
     , _read(SocketOperationRead),
     _write(SocketOperationWrite)
@@ -683,6 +778,7 @@ IceInternal::UdpTransceiver::UdpTransceiver(
     _fd = createServerSocket(true, _addr, instance->protocolSupport());
     setBufSize(-1, -1);
     setBlock(_fd, false);
+    initBatch();
 
     memset(&_mcastAddr.saStorage, 0, sizeof(sockaddr_storage));
     memset(&_peerAddr.saStorage, 0, sizeof(sockaddr_storage));
@@ -803,6 +899,161 @@ IceInternal::UdpTransceiver::setBufSize(int rcvSize, int sndSize)
     }
 }
 
+void
+IceInternal::UdpTransceiver::initBatch()
+{
+#if defined(ICE_HAS_MMSG)
+    if(_batchSize > 1)
+    {
+        _readMsgs.resize(_batchSize);
+        _readIovs.resize(_batchSize);
+        _readAddrs.resize(_batchSize);
+        _writeMsgs.resize(_batchSize);
+        _writeIovs.resize(_batchSize);
+    }
+#endif
+}
+
+void
+IceInternal::UdpTransceiver::connectToPeer()
+{
+    //
+    // If we must connect, we connect to the first peer that sends us a packet.
+    //
+    assert(_state == StateNeedConnect);
+    assert(_incoming); // Client connections should always be connected at this point.
+
+#ifndef NDEBUG
+    bool connected = doConnect(_fd, _peerAddr, Address());
+    assert(connected);
+#else
+    doConnect(_fd, _peerAddr, Address());
+#endif
+    _state = StateConnected;
+
+    if(_instance->traceLevel() >= 1)
+    {
+        Trace out(_instance->logger(), _instance->traceCategory());
+        out << "connected " << _instance->protocol() << " socket\n" << toString();
+    }
+}
+
+socklen_t
+IceInternal::UdpTransceiver::peerAddrLength() const
+{
+    if(_peerAddr.saStorage.ss_family == AF_INET)
+    {
+        return static_cast<socklen_t>(sizeof(sockaddr_in));
+    }
+    else if(_peerAddr.saStorage.ss_family == AF_INET6)
+    {
+        return static_cast<socklen_t>(sizeof(sockaddr_in6));
+    }
+    else
+    {
+        // No peer has sent a datagram yet.
+        throw SocketException(__FILE__, __LINE__, 0);
+    }
+}
+
+#if defined(ICE_HAS_MMSG)
+SocketOperation
+IceInternal::UdpTransceiver::readBatch(Buffer& buf)
+{
+    if(_readPos == _readCount)
+    {
+        const size_t packetSize = static_cast<size_t>(min(_maxPacketSize, _rcvSize - _udpOverhead));
+        //
+        // All the datagrams from the previous batch were returned, receive
+        // up to _batchSize datagrams with a single system call.
+        //
+        if(_readBatch.size() != packetSize * _batchSize)
+        {
+            _readBatch.resize(packetSize * _batchSize);
+        }
+
+        for(size_t i = 0; i < _batchSize; ++i)
+        {
+            _readIovs[i].iov_base = &_readBatch[i * packetSize];
+            _readIovs[i].iov_len = packetSize;
+            memset(&_readMsgs[i], 0, sizeof(mmsghdr));
+            _readMsgs[i].msg_hdr.msg_iov = &_readIovs[i];
+            _readMsgs[i].msg_hdr.msg_iovlen = 1;
+            if(_state != StateConnected)
+            {
+                assert(_incoming);
+                _readMsgs[i].msg_hdr.msg_name = &_readAddrs[i].saStorage;
+                _readMsgs[i].msg_hdr.msg_namelen = static_cast<socklen_t>(sizeof(sockaddr_storage));
+            }
+        }
+
+    repeat:
+
+        int ret = ::recvmmsg(_fd, &_readMsgs[0], static_cast<unsigned int>(_batchSize), 0, nullptr);
+        if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                goto repeat;
+            }
+
+            if(wouldBlock())
+            {
+                return SocketOperationRead;
+            }
+
+            if(connectionLost())
+            {
+                throw ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+        _readCount = static_cast<size_t>(ret);
+        _readPos = 0;
+
+        //
+        // Tell the thread pool to call us again until all the datagrams are
+        // read, the socket might not be readable anymore.
+        //
+        if(_readCount > 1)
+        {
+            ready(SocketOperationRead, true);
+        }
+    }
+
+    //
+    // Truncated datagrams fill the whole packet, this is detected at the
+    // connection level when the Ice message size is checked against the
+    // buffer size.
+    //
+    const size_t stride = _readBatch.size() / _batchSize;
+    buf.b.resize(_readMsgs[_readPos].msg_len);
+    if(!buf.b.empty())
+    {
+        memcpy(&buf.b[0], &_readBatch[_readPos * stride], buf.b.size());
+    }
+    buf.i = buf.b.end();
+    if(_state != StateConnected)
+    {
+        _peerAddr = _readAddrs[_readPos];
+    }
+
+    if(++_readPos == _readCount && _readCount > 1)
+    {
+        ready(SocketOperationRead, false);
+    }
+
+    if(_state == StateNeedConnect)
+    {
+        connectToPeer();
+    }
+    return SocketOperationNone;
+}
+#endif
+
 //
 // The maximum IP datagram size is 65535. Subtract 20 bytes for the IP header and 8 bytes for the UDP header
 // to get the maximum payload.
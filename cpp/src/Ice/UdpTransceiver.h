@@ -43,6 +43,8 @@ public:
     EndpointIPtr bind() final;
     SocketOperation write(Buffer&) final;
     SocketOperation read(Buffer&) final;
+    SocketOperation writev(const std::vector<Buffer*>&) final;
+    bool hasBufferedData() const final;
 #if defined(ICE_USE_IOCP)
     bool startWrite(Buffer&) final;
     void finishWrite(Buffer&) final;
@@ -61,6 +63,12 @@ public:
 private:
 
     void setBufSize(int, int);
+    void initBatch();
+    void connectToPeer();
+    socklen_t peerAddrLength() const;
+#if defined(ICE_HAS_MMSG)
+    SocketOperation readBatch(Buffer&);
+#endif
 
     UdpEndpointIPtr _endpoint;
     const ProtocolInstancePtr _instance;
@@ -82,6 +90,23 @@ private:
     static const int _udpOverhead;
     static const int _maxPacketSize;
 
+#if defined(ICE_HAS_MMSG)
+    //
+    // With Ice.UDP.BatchSize, up to _batchSize datagrams are received or sent
+    // with a single recvmmsg or sendmmsg call. The received datagrams are kept
+    // in _readBatch until they are returned by read().
+    //
+    const size_t _batchSize;
+    std::vector<Ice::Byte> _readBatch;
+    std::vector<mmsghdr> _readMsgs;
+    std::vector<iovec> _readIovs;
+    std::vector<Address> _readAddrs;
+    size_t _readCount;
+    size_t _readPos;
+    std::vector<mmsghdr> _writeMsgs;
+    std::vector<iovec> _writeIovs;
+#endif
+
 #if defined(ICE_USE_IOCP)
     AsyncInfo _read;
     AsyncInfo _write;
@@ -0,0 +1,183 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Config.h>
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#include <Ice/UnixAcceptor.h>
+#include <Ice/UnixTransceiver.h>
+#include <Ice/EndpointI.h>
+#include <Ice/ProtocolInstance.h>
+#include <Ice/LocalException.h>
+#include <Ice/Properties.h>
+#include <Ice/StreamSocket.h>
+
+#include <sys/stat.h>
+
+//
+// Use the system default for the listen() backlog or 511 if not defined.
+//
+#ifndef SOMAXCONN
+#  define SOMAXCONN 511
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+//
+// Remove the socket file at the given path if no server is listening on it.
+// The file is typically left over by a server that didn't shut down cleanly.
+//
+bool
+removeStaleSocket(const string& path, const Address& addr)
+{
+    struct stat st;
+    if(lstat(path.c_str(), &st) != 0 || !S_ISSOCK(st.st_mode))
+    {
+        return false;
+    }
+
+    SOCKET fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(fd == INVALID_SOCKET)
+    {
+        return false;
+    }
+
+    //
+    // A non-blocking connect either succeeds or fails with EAGAIN if a server
+    // is listening, it fails with ECONNREFUSED otherwise.
+    //
+    bool stale = false;
+    try
+    {
+        setBlock(fd, false);
+        stale = ::connect(fd, &addr.sa, static_cast<socklen_t>(sizeof(sockaddr_un))) == SOCKET_ERROR &&
+            getSocketErrno() == ECONNREFUSED;
+    }
+    catch(const SocketException&)
+    {
+        return false; // setBlock closes the socket on failure.
+    }
+    closeSocketNoThrow(fd);
+    return stale && unlink(path.c_str()) == 0;
+}
+
+}
+
+NativeInfoPtr
+IceInternal::UnixAcceptor::getNativeInfo()
+{
+    return shared_from_this();
+}
+
+void
+IceInternal::UnixAcceptor::close()
+{
+    if(_fd != INVALID_SOCKET)
+    {
+        closeSocketNoThrow(_fd);
+        _fd = INVALID_SOCKET;
+    }
+
+    //
+    // Remove the socket file unless another server replaced it.
+    //
+    if(_ino != 0)
+    {
+        struct stat st;
+        if(lstat(_path.c_str(), &st) == 0 && st.st_ino == _ino)
+        {
+            unlink(_path.c_str());
+        }
+        _ino = 0;
+    }
+}
+
+EndpointIPtr
+IceInternal::UnixAcceptor::listen()
+{
+    try
+    {
+        if(::bind(_fd, &_addr.sa, static_cast<socklen_t>(sizeof(sockaddr_un))) == SOCKET_ERROR)
+        {
+            int error = getSocketErrno();
+            if(error != EADDRINUSE || !removeStaleSocket(_path, _addr))
+            {
+                closeSocketNoThrow(_fd);
+                throw SocketException(__FILE__, __LINE__, error);
+            }
+            doBind(_fd, _addr);
+        }
+
+        struct stat st;
+        if(lstat(_path.c_str(), &st) == 0)
+        {
+            _ino = st.st_ino;
+        }
+
+        doListen(_fd, _backlog);
+    }
+    catch(...)
+    {
+        _fd = INVALID_SOCKET;
+        close();
+        throw;
+    }
+
+    //
+    // The path doesn't change when the acceptor is bound, the endpoint is
+    // published as is.
+    //
+    return _endpoint;
+}
+
+TransceiverPtr
+IceInternal::UnixAcceptor::accept()
+{
+    return make_shared<UnixTransceiver>(_instance, make_shared<StreamSocket>(_instance, doAccept(_fd, false)));
+}
+
+string
+IceInternal::UnixAcceptor::protocol() const
+{
+    return _instance->protocol();
+}
+
+string
+IceInternal::UnixAcceptor::toString() const
+{
+    return _path;
+}
+
+string
+IceInternal::UnixAcceptor::toDetailedString() const
+{
+    return "local address = " + toString();
+}
+
+IceInternal::UnixAcceptor::UnixAcceptor(const EndpointIPtr& endpoint, const ProtocolInstancePtr& instance,
+                                        const string& path) :
+    _endpoint(endpoint),
+    _instance(instance),
+    _path(path),
+    _addr(getUnixAddress(path)),
+    _ino(0)
+{
+    _backlog = instance->properties()->getPropertyAsIntWithDefault("Ice.TCP.Backlog", SOMAXCONN);
+    _fd = createSocket(false, _addr);
+    setBlock(_fd, false);
+    setTcpBufSize(_fd, _instance);
+}
+
+IceInternal::UnixAcceptor::~UnixAcceptor()
+{
+    assert(_fd == INVALID_SOCKET);
+}
+
+#endif
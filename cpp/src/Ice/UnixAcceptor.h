@@ -0,0 +1,51 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_UNIX_ACCEPTOR_H
+#define ICE_UNIX_ACCEPTOR_H
+
+#include <Ice/TransceiverF.h>
+#include <Ice/ProtocolInstanceF.h>
+#include <Ice/Acceptor.h>
+#include <Ice/Network.h>
+
+#include <sys/types.h>
+
+namespace IceInternal
+{
+
+class UnixAcceptor final : public Acceptor, public NativeInfo, public std::enable_shared_from_this<UnixAcceptor>
+{
+public:
+
+    UnixAcceptor(const EndpointIPtr&, const ProtocolInstancePtr&, const std::string&);
+    ~UnixAcceptor();
+    NativeInfoPtr getNativeInfo() final;
+
+    void close() final;
+    EndpointIPtr listen() final;
+
+    TransceiverPtr accept() final;
+    std::string protocol() const final;
+    std::string toString() const final;
+    std::string toDetailedString() const final;
+
+private:
+
+    const EndpointIPtr _endpoint;
+    const ProtocolInstancePtr _instance;
+    const std::string _path;
+    const Address _addr;
+
+    int _backlog;
+
+    //
+    // The inode of the socket file created by listen(), it's used to check
+    // that the file wasn't replaced before removing it on close.
+    //
+    ino_t _ino;
+};
+
+}
+#endif
@@ -0,0 +1,105 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Config.h>
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#include <Ice/UnixConnector.h>
+#include <Ice/UnixTransceiver.h>
+#include <Ice/ProtocolInstance.h>
+#include <Ice/StreamSocket.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+TransceiverPtr
+IceInternal::UnixConnector::connect()
+{
+    return make_shared<UnixTransceiver>(_instance, make_shared<StreamSocket>(_instance, nullptr, _addr, Address()));
+}
+
+Short
+IceInternal::UnixConnector::type() const
+{
+    return _instance->type();
+}
+
+string
+IceInternal::UnixConnector::toString() const
+{
+    return _path;
+}
+
+bool
+IceInternal::UnixConnector::operator==(const Connector& r) const
+{
+    const UnixConnector* p = dynamic_cast<const UnixConnector*>(&r);
+    if(!p)
+    {
+        return false;
+    }
+
+    if(_path != p->_path)
+    {
+        return false;
+    }
+
+    if(_timeout != p->_timeout)
+    {
+        return false;
+    }
+
+    if(_connectionId != p->_connectionId)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool
+IceInternal::UnixConnector::operator<(const Connector& r) const
+{
+    const UnixConnector* p = dynamic_cast<const UnixConnector*>(&r);
+    if(!p)
+    {
+        return type() < r.type();
+    }
+
+    if(_timeout < p->_timeout)
+    {
+        return true;
+    }
+    else if(p->_timeout < _timeout)
+    {
+        return false;
+    }
+
+    if(_connectionId < p->_connectionId)
+    {
+        return true;
+    }
+    else if(p->_connectionId < _connectionId)
+    {
+        return false;
+    }
+    return _path < p->_path;
+}
+
+IceInternal::UnixConnector::UnixConnector(const ProtocolInstancePtr& instance, const string& path, int32_t timeout,
+                                          const string& connectionId) :
+    _instance(instance),
+    _path(path),
+    _addr(getUnixAddress(path)),
+    _timeout(timeout),
+    _connectionId(connectionId)
+{
+}
+
+IceInternal::UnixConnector::~UnixConnector()
+{
+}
+#endif
@@ -0,0 +1,41 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_UNIX_CONNECTOR_H
+#define ICE_UNIX_CONNECTOR_H
+
+#include <Ice/TransceiverF.h>
+#include <Ice/ProtocolInstanceF.h>
+#include <Ice/Connector.h>
+#include <Ice/Network.h>
+
+namespace IceInternal
+{
+
+class UnixConnector final : public Connector
+{
+public:
+
+    UnixConnector(const ProtocolInstancePtr&, const std::string&, std::int32_t, const std::string&);
+    ~UnixConnector();
+    TransceiverPtr connect() final;
+
+    Ice::Short type() const final;
+    std::string toString() const final;
+
+    bool operator==(const Connector&) const final;
+    bool operator<(const Connector&) const final;
+
+private:
+
+    const ProtocolInstancePtr _instance;
+    const std::string _path;
+    const Address _addr;
+    const std::int32_t _timeout;
+    const std::string _connectionId;
+};
+
+}
+
+#endif
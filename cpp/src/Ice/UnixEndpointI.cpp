@@ -0,0 +1,508 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Config.h>
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#include <Ice/UnixEndpointI.h>
+#include <Ice/UnixAcceptor.h>
+#include <Ice/UnixConnector.h>
+#include <Ice/Network.h>
+#include <Ice/OutputStream.h>
+#include <Ice/InputStream.h>
+#include <Ice/LocalException.h>
+#include <Ice/ProtocolInstance.h>
+#include <Ice/HashUtil.h>
+#include <Ice/Initialize.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+extern "C"
+{
+
+Plugin*
+createIceUNIX(const CommunicatorPtr& c, const string&, const StringSeq&)
+{
+    return new EndpointFactoryPlugin(
+        c,
+        make_shared<UnixEndpointFactory>(make_shared<ProtocolInstance>(c, UNIXEndpointType, "unix", false)));
+}
+
+}
+
+namespace Ice
+{
+
+ICE_API void
+registerIceUNIX(bool loadOnInitialize)
+{
+    Ice::registerPluginFactory("IceUNIX", createIceUNIX, loadOnInitialize);
+}
+
+}
+
+IceInternal::UnixEndpointI::UnixEndpointI(const ProtocolInstancePtr& instance, const string& path, int32_t timeout,
+                                          const string& connectionId, bool compress) :
+    _instance(instance),
+    _path(path),
+    _timeout(timeout),
+    _connectionId(connectionId),
+    _compress(compress),
+    _hashValue(0)
+{
+    hashInit();
+}
+
+IceInternal::UnixEndpointI::UnixEndpointI(const ProtocolInstancePtr& instance) :
+    _instance(instance),
+    _timeout(instance->defaultTimeout()),
+    _compress(false),
+    _hashValue(0)
+{
+}
+
+IceInternal::UnixEndpointI::UnixEndpointI(const ProtocolInstancePtr& instance, InputStream* s) :
+    _instance(instance),
+    _timeout(-1),
+    _compress(false),
+    _hashValue(0)
+{
+    s->read(const_cast<string&>(_path), false);
+    s->read(const_cast<int32_t&>(_timeout));
+    s->read(const_cast<bool&>(_compress));
+    hashInit();
+}
+
+void
+IceInternal::UnixEndpointI::streamWriteImpl(OutputStream* s) const
+{
+    s->write(_path, false);
+    s->write(_timeout);
+    s->write(_compress);
+}
+
+Short
+IceInternal::UnixEndpointI::type() const
+{
+    return _instance->type();
+}
+
+const string&
+IceInternal::UnixEndpointI::protocol() const
+{
+    return _instance->protocol();
+}
+
+int32_t
+IceInternal::UnixEndpointI::timeout() const
+{
+    return _timeout;
+}
+
+EndpointIPtr
+IceInternal::UnixEndpointI::timeout(int32_t timeout) const
+{
+    if(timeout == _timeout)
+    {
+        return const_cast<UnixEndpointI*>(this)->shared_from_this();
+    }
+    else
+    {
+        return make_shared<UnixEndpointI>(_instance, _path, timeout, _connectionId, _compress);
+    }
+}
+
+const string&
+IceInternal::UnixEndpointI::connectionId() const
+{
+    return _connectionId;
+}
+
+EndpointIPtr
+IceInternal::UnixEndpointI::connectionId(const string& connectionId) const
+{
+    if(connectionId == _connectionId)
+    {
+        return const_cast<UnixEndpointI*>(this)->shared_from_this();
+    }
+    else
+    {
+        return make_shared<UnixEndpointI>(_instance, _path, _timeout, connectionId, _compress);
+    }
+}
+
+bool
+IceInternal::UnixEndpointI::compress() const
+{
+    return _compress;
+}
+
+EndpointIPtr
+IceInternal::UnixEndpointI::compress(bool compress) const
+{
+    if(compress == _compress)
+    {
+        return const_cast<UnixEndpointI*>(this)->shared_from_this();
+    }
+    else
+    {
+        return make_shared<UnixEndpointI>(_instance, _path, _timeout, _connectionId, compress);
+    }
+}
+
+bool
+IceInternal::UnixEndpointI::datagram() const
+{
+    return false;
+}
+
+bool
+IceInternal::UnixEndpointI::secure() const
+{
+    return _instance->secure();
+}
+
+TransceiverPtr
+IceInternal::UnixEndpointI::transceiver() const
+{
+    return nullptr;
+}
+
+void
+IceInternal::UnixEndpointI::connectorsAsync(
+    EndpointSelectionType,
+    function<void(vector<ConnectorPtr>)> response,
+    function<void(exception_ptr)>) const
+{
+    //
+    // There's no name resolution, the path is the address of the socket.
+    //
+    vector<ConnectorPtr> connectors;
+    connectors.emplace_back(make_shared<UnixConnector>(_instance, _path, _timeout, _connectionId));
+    response(std::move(connectors));
+}
+
+AcceptorPtr
+IceInternal::UnixEndpointI::acceptor(const string&) const
+{
+    return make_shared<UnixAcceptor>(const_cast<UnixEndpointI*>(this)->shared_from_this(), _instance, _path);
+}
+
+vector<EndpointIPtr>
+IceInternal::UnixEndpointI::expandIfWildcard() const
+{
+    vector<EndpointIPtr> endps;
+    endps.push_back(const_cast<UnixEndpointI*>(this)->shared_from_this());
+    return endps;
+}
+
+vector<EndpointIPtr>
+IceInternal::UnixEndpointI::expandHost(EndpointIPtr&) const
+{
+    //
+    // Nothing to do here.
+    //
+    vector<EndpointIPtr> endps;
+    endps.push_back(const_cast<UnixEndpointI*>(this)->shared_from_this());
+    return endps;
+}
+
+bool
+IceInternal::UnixEndpointI::equivalent(const EndpointIPtr& endpoint) const
+{
+    const UnixEndpointI* unixEndpointI = dynamic_cast<const UnixEndpointI*>(endpoint.get());
+    if(!unixEndpointI)
+    {
+        return false;
+    }
+    return unixEndpointI->type() == type() && unixEndpointI->_path == _path;
+}
+
+bool
+IceInternal::UnixEndpointI::operator==(const Endpoint& r) const
+{
+    const UnixEndpointI* p = dynamic_cast<const UnixEndpointI*>(&r);
+    if(!p)
+    {
+        return false;
+    }
+
+    if(this == p)
+    {
+        return true;
+    }
+
+    if(_path != p->_path)
+    {
+        return false;
+    }
+
+    if(_connectionId != p->_connectionId)
+    {
+        return false;
+    }
+
+    if(_timeout != p->_timeout)
+    {
+        return false;
+    }
+
+    if(_compress != p->_compress)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool
+IceInternal::UnixEndpointI::operator<(const Endpoint& r) const
+{
+    const UnixEndpointI* p = dynamic_cast<const UnixEndpointI*>(&r);
+    if(!p)
+    {
+        const EndpointI* e = dynamic_cast<const EndpointI*>(&r);
+        if(!e)
+        {
+            return false;
+        }
+        return type() < e->type();
+    }
+
+    if(this == p)
+    {
+        return false;
+    }
+
+    if(_path < p->_path)
+    {
+        return true;
+    }
+    else if(p->_path < _path)
+    {
+        return false;
+    }
+
+    if(_connectionId < p->_connectionId)
+    {
+        return true;
+    }
+    else if(p->_connectionId < _connectionId)
+    {
+        return false;
+    }
+
+    if(_timeout < p->_timeout)
+    {
+        return true;
+    }
+    else if(p->_timeout < _timeout)
+    {
+        return false;
+    }
+
+    if(!_compress && p->_compress)
+    {
+        return true;
+    }
+    else if(p->_compress < _compress)
+    {
+        return false;
+    }
+
+    return false;
+}
+
+int32_t
+IceInternal::UnixEndpointI::hash() const
+{
+    return _hashValue;
+}
+
+string
+IceInternal::UnixEndpointI::options() const
+{
+    //
+    // WARNING: Certain features, such as proxy validation in Glacier2,
+    // depend on the format of proxy strings. Changes to toString() and
+    // methods called to generate parts of the reference string could break
+    // these features. Please review for all features that depend on the
+    // format of proxyToString() before changing this and related code.
+    //
+    ostringstream s;
+
+    if(!_path.empty())
+    {
+        s << " -f ";
+        bool addQuote = _path.find_first_of(": \t\n\r") != string::npos;
+        if(addQuote)
+        {
+            s << "\"";
+        }
+        s << _path;
+        if(addQuote)
+        {
+            s << "\"";
+        }
+    }
+
+    if(_timeout == -1)
+    {
+        s << " -t infinite";
+    }
+    else
+    {
+        s << " -t " << _timeout;
+    }
+
+    if(_compress)
+    {
+        s << " -z";
+    }
+
+    return s.str();
+}
+
+EndpointInfoPtr
+IceInternal::UnixEndpointI::getInfo() const noexcept
+{
+    auto info = make_shared<InfoI<Ice::UNIXEndpointInfo>>(const_cast<UnixEndpointI*>(this)->shared_from_this());
+    info->path = _path;
+    return info;
+}
+
+void
+IceInternal::UnixEndpointI::initWithOptions(vector<string>& args)
+{
+    EndpointI::initWithOptions(args);
+
+    if(_path.empty())
+    {
+        throw EndpointParseException(__FILE__, __LINE__, "a path must be specified using the -f option in endpoint `" +
+                                     toString() + "'");
+    }
+
+    hashInit();
+}
+
+bool
+IceInternal::UnixEndpointI::checkOption(const string& option, const string& argument, const string& endpoint)
+{
+    if(option == "-f")
+    {
+        if(argument.empty())
+        {
+            throw EndpointParseException(__FILE__, __LINE__, "no argument provided for -f option in endpoint " +
+                                         endpoint);
+        }
+
+        //
+        // The path must fit in sockaddr_un with its terminating null character.
+        //
+        if(argument.size() >= sizeof(sockaddr_un::sun_path))
+        {
+            throw EndpointParseException(__FILE__, __LINE__, "path `" + argument + "' is too long in endpoint " +
+                                         endpoint);
+        }
+        const_cast<string&>(_path) = argument;
+    }
+    else if(option == "-t")
+    {
+        if(argument.empty())
+        {
+            throw EndpointParseException(__FILE__, __LINE__, "no argument provided for -t option in endpoint " +
+                                         endpoint);
+        }
+
+        if(argument == "infinite")
+        {
+            const_cast<int32_t&>(_timeout) = -1;
+        }
+        else
+        {
+            istringstream t(argument);
+            if(!(t >> const_cast<int32_t&>(_timeout)) || !t.eof() || _timeout < 1)
+            {
+                throw EndpointParseException(__FILE__, __LINE__, "invalid timeout value `" + argument +
+                                             "' in endpoint " + endpoint);
+            }
+        }
+    }
+    else if(option == "-z")
+    {
+        if(!argument.empty())
+        {
+            throw EndpointParseException(__FILE__, __LINE__, "unexpected argument `" + argument +
+                                         "' provided for -z option in " + endpoint);
+        }
+        const_cast<bool&>(_compress) = true;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+void
+IceInternal::UnixEndpointI::hashInit()
+{
+    int32_t h = 5381;
+    hashAdd(h, type());
+    hashAdd(h, _path);
+    hashAdd(h, _timeout);
+    hashAdd(h, _connectionId);
+    hashAdd(h, _compress);
+    const_cast<int32_t&>(_hashValue) = h;
+}
+
+IceInternal::UnixEndpointFactory::UnixEndpointFactory(const ProtocolInstancePtr& instance) : _instance(instance)
+{
+}
+
+IceInternal::UnixEndpointFactory::~UnixEndpointFactory()
+{
+}
+
+Short
+IceInternal::UnixEndpointFactory::type() const
+{
+    return _instance->type();
+}
+
+string
+IceInternal::UnixEndpointFactory::protocol() const
+{
+    return _instance->protocol();
+}
+
+EndpointIPtr
+IceInternal::UnixEndpointFactory::create(vector<string>& args, bool) const
+{
+    auto endpt = make_shared<UnixEndpointI>(_instance);
+    endpt->initWithOptions(args);
+    return endpt;
+}
+
+EndpointIPtr
+IceInternal::UnixEndpointFactory::read(InputStream* s) const
+{
+    return make_shared<UnixEndpointI>(_instance, s);
+}
+
+void
+IceInternal::UnixEndpointFactory::destroy()
+{
+    _instance = nullptr;
+}
+
+EndpointFactoryPtr
+IceInternal::UnixEndpointFactory::clone(const ProtocolInstancePtr& instance) const
+{
+    return make_shared<UnixEndpointFactory>(instance);
+}
+#endif
@@ -0,0 +1,101 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_UNIX_ENDPOINT_I_H
+#define ICE_UNIX_ENDPOINT_I_H
+
+#include <IceUtil/Config.h>
+#include <Ice/EndpointI.h>
+#include <Ice/EndpointFactory.h>
+#include <Ice/ProtocolInstanceF.h>
+
+namespace IceInternal
+{
+
+//
+// An endpoint for Unix domain stream sockets. The endpoint is identified by
+// the file system path of the socket, which is set with the -f option.
+//
+class UnixEndpointI final : public EndpointI, public std::enable_shared_from_this<UnixEndpointI>
+{
+public:
+
+    UnixEndpointI(const ProtocolInstancePtr&, const std::string&, std::int32_t, const std::string&, bool);
+    UnixEndpointI(const ProtocolInstancePtr&);
+    UnixEndpointI(const ProtocolInstancePtr&, Ice::InputStream*);
+
+    void streamWriteImpl(Ice::OutputStream*) const final;
+    Ice::Short type() const final;
+    const std::string& protocol() const final;
+    std::int32_t timeout() const final;
+    EndpointIPtr timeout(std::int32_t) const final;
+    const std::string& connectionId() const final;
+    EndpointIPtr connectionId(const std::string&) const final;
+    bool compress() const final;
+    EndpointIPtr compress(bool) const final;
+    bool datagram() const final;
+    bool secure() const final;
+    TransceiverPtr transceiver() const final;
+    void connectorsAsync(
+        Ice::EndpointSelectionType,
+        std::function<void(std::vector<ConnectorPtr>)>,
+        std::function<void(std::exception_ptr)>) const final;
+    AcceptorPtr acceptor(const std::string&) const final;
+    std::vector<EndpointIPtr> expandIfWildcard() const final;
+    std::vector<EndpointIPtr> expandHost(EndpointIPtr&) const final;
+    bool equivalent(const EndpointIPtr&) const final;
+
+    bool operator==(const Ice::Endpoint&) const final;
+    bool operator<(const Ice::Endpoint&) const final;
+
+    std::int32_t hash() const final;
+
+    std::string options() const final;
+
+    Ice::EndpointInfoPtr getInfo() const noexcept final;
+
+    void initWithOptions(std::vector<std::string>&);
+
+protected:
+
+    bool checkOption(const std::string&, const std::string&, const std::string&) final;
+
+private:
+
+    void hashInit();
+
+    //
+    // All members are const, because endpoints are immutable.
+    //
+    const ProtocolInstancePtr _instance;
+    const std::string _path;
+    const std::int32_t _timeout;
+    const std::string _connectionId;
+    const bool _compress;
+    const std::int32_t _hashValue;
+};
+
+class UnixEndpointFactory final : public EndpointFactory
+{
+public:
+
+    UnixEndpointFactory(const ProtocolInstancePtr&);
+    ~UnixEndpointFactory();
+
+    Ice::Short type() const final;
+    std::string protocol() const final;
+    EndpointIPtr create(std::vector<std::string>&, bool) const final;
+    EndpointIPtr read(Ice::InputStream*) const final;
+    void destroy() final;
+
+    EndpointFactoryPtr clone(const ProtocolInstancePtr&) const final;
+
+private:
+
+    ProtocolInstancePtr _instance;
+};
+
+}
+
+#endif
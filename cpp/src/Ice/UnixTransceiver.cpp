@@ -0,0 +1,149 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Config.h>
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#include <Ice/UnixTransceiver.h>
+#include <Ice/Connection.h>
+#include <Ice/ProtocolInstance.h>
+#include <Ice/Buffer.h>
+#include <Ice/LocalException.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+NativeInfoPtr
+IceInternal::UnixTransceiver::getNativeInfo()
+{
+    return _stream;
+}
+
+SocketOperation
+IceInternal::UnixTransceiver::initialize(Buffer& readBuffer, Buffer& writeBuffer)
+{
+    return _stream->connect(readBuffer, writeBuffer);
+}
+
+SocketOperation
+IceInternal::UnixTransceiver::closing(bool initiator, exception_ptr)
+{
+    // If we are initiating the connection closure, wait for the peer
+    // to close the connection. Otherwise, close immediately.
+    return initiator ? SocketOperationRead : SocketOperationNone;
+}
+
+void
+IceInternal::UnixTransceiver::close()
+{
+    _stream->close();
+}
+
+SocketOperation
+IceInternal::UnixTransceiver::write(Buffer& buf)
+{
+    return _stream->write(buf);
+}
+
+SocketOperation
+IceInternal::UnixTransceiver::writev(const vector<Buffer*>& bufs)
+{
+    return _stream->writev(bufs);
+}
+
+SocketOperation
+IceInternal::UnixTransceiver::read(Buffer& buf)
+{
+    return _stream->read(buf);
+}
+
+string
+IceInternal::UnixTransceiver::protocol() const
+{
+    return _instance->protocol();
+}
+
+string
+IceInternal::UnixTransceiver::toString() const
+{
+    return _stream->toString();
+}
+
+string
+IceInternal::UnixTransceiver::toDetailedString() const
+{
+    return toString();
+}
+
+Ice::ConnectionInfoPtr
+IceInternal::UnixTransceiver::getInfo() const
+{
+    UNIXConnectionInfoPtr info = std::make_shared<UNIXConnectionInfo>();
+    SOCKET fd = _stream->fd();
+    if(fd != INVALID_SOCKET)
+    {
+        //
+        // The socket of an incoming connection is bound to the path of the
+        // acceptor, the socket of an outgoing connection is usually unnamed.
+        //
+        Address addr;
+        fdToLocalAddress(fd, addr);
+        if(addr.saUn.sun_path[0] == '\0')
+        {
+            fdToRemoteAddress(fd, addr);
+        }
+        info->path = inetAddrToString(addr);
+
+        //
+        // The credentials of the peer are those it had when it connected or
+        // called listen.
+        //
+#if defined(__linux__)
+        struct ucred cred;
+        socklen_t len = static_cast<socklen_t>(sizeof(cred));
+        if(getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) == 0)
+        {
+            info->pid = static_cast<int>(cred.pid);
+            info->uid = static_cast<int>(cred.uid);
+            info->gid = static_cast<int>(cred.gid);
+        }
+#else
+        uid_t uid;
+        gid_t gid;
+        if(getpeereid(fd, &uid, &gid) == 0)
+        {
+            info->uid = static_cast<int>(uid);
+            info->gid = static_cast<int>(gid);
+        }
+#endif
+
+        info->rcvSize = getRecvBufferSize(fd);
+        info->sndSize = getSendBufferSize(fd);
+    }
+    return info;
+}
+
+void
+IceInternal::UnixTransceiver::checkSendSize(const Buffer&)
+{
+}
+
+void
+IceInternal::UnixTransceiver::setBufferSize(int rcvSize, int sndSize)
+{
+    _stream->setBufferSize(rcvSize, sndSize);
+}
+
+IceInternal::UnixTransceiver::UnixTransceiver(const ProtocolInstancePtr& instance, const StreamSocketPtr& stream) :
+    _instance(instance),
+    _stream(stream)
+{
+}
+
+IceInternal::UnixTransceiver::~UnixTransceiver()
+{
+}
+#endif
@@ -0,0 +1,46 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_UNIX_TRANSCEIVER_H
+#define ICE_UNIX_TRANSCEIVER_H
+
+#include <Ice/ProtocolInstanceF.h>
+#include <Ice/Transceiver.h>
+#include <Ice/Network.h>
+#include <Ice/StreamSocket.h>
+
+namespace IceInternal
+{
+
+class UnixTransceiver final : public Transceiver
+{
+public:
+
+    UnixTransceiver(const ProtocolInstancePtr&, const StreamSocketPtr&);
+    ~UnixTransceiver();
+    NativeInfoPtr getNativeInfo() final;
+
+    SocketOperation initialize(Buffer&, Buffer&) final;
+    SocketOperation closing(bool, std::exception_ptr) final;
+
+    void close() final;
+    SocketOperation write(Buffer&) final;
+    SocketOperation read(Buffer&) final;
+    SocketOperation writev(const std::vector<Buffer*>&) final;
+    std::string protocol() const final;
+    std::string toString() const final;
+    std::string toDetailedString() const final;
+    Ice::ConnectionInfoPtr getInfo() const final;
+    void checkSendSize(const Buffer&) final;
+    void setBufferSize(int rcvSize, int sndSize) final;
+
+private:
+
+    const ProtocolInstancePtr _instance;
+    const StreamSocketPtr _stream;
+};
+
+}
+
+#endif
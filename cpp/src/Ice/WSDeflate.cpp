@@ -0,0 +1,380 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/WSDeflate.h>
+#include <Ice/LocalException.h>
+#include <IceUtil/StringUtil.h>
+
+#ifdef ICE_HAS_ZLIB
+#  include <zlib.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+const string extensionName = "permessage-deflate";
+
+bool
+parseWindowBits(const string& value, int& bits)
+{
+    if(value.empty() || value.size() > 2 || value.find_first_not_of("0123456789") != string::npos)
+    {
+        return false;
+    }
+    bits = atoi(value.c_str());
+    return bits >= 8 && bits <= 15;
+}
+
+}
+
+IceInternal::WSDeflateParameters::WSDeflateParameters() :
+    serverMaxWindowBits(0),
+    clientMaxWindowBits(0),
+    serverNoContextTakeover(false),
+    clientNoContextTakeover(false)
+{
+}
+
+bool
+IceInternal::wsDeflateSupported()
+{
+#ifdef ICE_HAS_ZLIB
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool
+IceInternal::parseWSDeflateParameters(const string& extension, WSDeflateParameters& params)
+{
+    vector<string> tokens;
+    if(!IceUtilInternal::splitString(extension, ";", tokens) || tokens.empty() ||
+       IceUtilInternal::toLower(IceUtilInternal::trim(tokens[0])) != extensionName)
+    {
+        return false;
+    }
+
+    params = WSDeflateParameters();
+    for(vector<string>::const_iterator p = tokens.begin() + 1; p != tokens.end(); ++p)
+    {
+        string name = IceUtilInternal::trim(*p);
+        string value;
+        bool hasValue = false;
+        string::size_type pos = name.find('=');
+        if(pos != string::npos)
+        {
+            value = IceUtilInternal::trim(name.substr(pos + 1));
+            name = IceUtilInternal::trim(name.substr(0, pos));
+            hasValue = true;
+        }
+        name = IceUtilInternal::toLower(name);
+
+        //
+        // Each parameter can only be specified once.
+        //
+        if(name == "server_no_context_takeover")
+        {
+            if(hasValue || params.serverNoContextTakeover)
+            {
+                return false;
+            }
+            params.serverNoContextTakeover = true;
+        }
+        else if(name == "client_no_context_takeover")
+        {
+            if(hasValue || params.clientNoContextTakeover)
+            {
+                return false;
+            }
+            params.clientNoContextTakeover = true;
+        }
+        else if(name == "server_max_window_bits")
+        {
+            if(params.serverMaxWindowBits != 0 || !parseWindowBits(value, params.serverMaxWindowBits))
+            {
+                return false;
+            }
+        }
+        else if(name == "client_max_window_bits")
+        {
+            if(params.clientMaxWindowBits != 0)
+            {
+                return false;
+            }
+            else if(!hasValue)
+            {
+                params.clientMaxWindowBits = 15;
+            }
+            else if(!parseWindowBits(value, params.clientMaxWindowBits))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+string
+IceInternal::formatWSDeflateParameters(const WSDeflateParameters& params)
+{
+    ostringstream out;
+    out << extensionName;
+    if(params.serverNoContextTakeover)
+    {
+        out << "; server_no_context_takeover";
+    }
+    if(params.clientNoContextTakeover)
+    {
+        out << "; client_no_context_takeover";
+    }
+    if(params.serverMaxWindowBits > 0)
+    {
+        out << "; server_max_window_bits=" << params.serverMaxWindowBits;
+    }
+    if(params.clientMaxWindowBits == 15)
+    {
+        out << "; client_max_window_bits";
+    }
+    else if(params.clientMaxWindowBits > 0)
+    {
+        out << "; client_max_window_bits=" << params.clientMaxWindowBits;
+    }
+    return out.str();
+}
+
+#ifdef ICE_HAS_ZLIB
+
+IceInternal::WSDeflater::WSDeflater(int level, int windowBits, bool noContextTakeover) :
+    _stream(new z_stream()),
+    _noContextTakeover(noContextTakeover)
+{
+    //
+    // zlib doesn't support raw deflate with a window of 8 bits, the
+    // negotiation never selects less than 9 bits for the compressor.
+    //
+    assert(windowBits >= 9 && windowBits <= 15);
+    if(deflateInit2(_stream, max(1, min(level, 9)), Z_DEFLATED, -windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        delete _stream;
+        throw CompressionException(__FILE__, __LINE__, "deflateInit2 failed");
+    }
+}
+
+IceInternal::WSDeflater::~WSDeflater()
+{
+    deflateEnd(_stream);
+    delete _stream;
+}
+
+size_t
+IceInternal::WSDeflater::compress(const Byte* in, size_t inSize, Byte* out, size_t outSize)
+{
+    _stream->next_in = const_cast<Bytef*>(in);
+    _stream->avail_in = static_cast<uInt>(inSize);
+    _stream->next_out = out;
+    _stream->avail_out = static_cast<uInt>(outSize);
+
+    int rc = deflate(_stream, Z_SYNC_FLUSH);
+    if(rc != Z_OK && rc != Z_BUF_ERROR)
+    {
+        reset();
+        throw CompressionException(__FILE__, __LINE__, "deflate failed");
+    }
+
+    //
+    // If the output buffer is full, the compressed message might not be
+    // complete. The compressor is reset since the peer never sees this data.
+    //
+    if(_stream->avail_in > 0 || _stream->avail_out == 0)
+    {
+        reset();
+        return 0;
+    }
+
+    size_t size = outSize - _stream->avail_out;
+    assert(size >= 4 && memcmp(out + size - 4, "\x00\x00\xff\xff", 4) == 0);
+    if(_noContextTakeover)
+    {
+        reset();
+    }
+    return size - 4;
+}
+
+void
+IceInternal::WSDeflater::reset()
+{
+    deflateReset(_stream);
+}
+
+IceInternal::WSInflater::WSInflater() :
+    _stream(new z_stream()),
+    _finish(false),
+    _outputPending(false)
+{
+    //
+    // Decompressing with the largest window works with any window size used
+    // by the peer, so the negotiated server or client window isn't needed.
+    //
+    if(inflateInit2(_stream, -15) != Z_OK)
+    {
+        delete _stream;
+        throw CompressionException(__FILE__, __LINE__, "inflateInit2 failed");
+    }
+}
+
+IceInternal::WSInflater::~WSInflater()
+{
+    inflateEnd(_stream);
+    delete _stream;
+}
+
+void
+IceInternal::WSInflater::setInput(const Byte* in, size_t size)
+{
+    assert(_stream->avail_in == 0 && !_finish);
+    _stream->next_in = const_cast<Bytef*>(in);
+    _stream->avail_in = static_cast<uInt>(size);
+}
+
+void
+IceInternal::WSInflater::finishMessage()
+{
+    _finish = true;
+}
+
+bool
+IceInternal::WSInflater::inflate(Buffer& buf)
+{
+    static const Byte trailer[] = { 0x00, 0x00, 0xff, 0xff };
+
+    while(true)
+    {
+        if(_stream->avail_in == 0 && _finish)
+        {
+            _stream->next_in = const_cast<Bytef*>(trailer);
+            _stream->avail_in = sizeof(trailer);
+            _finish = false;
+        }
+
+        if(_stream->avail_in == 0 && !_outputPending)
+        {
+            return true;
+        }
+        else if(buf.i == buf.b.end())
+        {
+            return false;
+        }
+
+        //
+        // The output is written directly to the message buffer, its size is
+        // already checked against the connection's maximum message size.
+        //
+        _stream->next_out = buf.i;
+        _stream->avail_out = static_cast<uInt>(buf.b.end() - buf.i);
+        int rc = ::inflate(_stream, Z_SYNC_FLUSH);
+        buf.i = _stream->next_out;
+
+        if(rc == Z_STREAM_END)
+        {
+            //
+            // The peer ended the deflate stream with a final block, the next
+            // message starts a new stream.
+            //
+            inflateReset(_stream);
+            _stream->avail_in = 0;
+            _outputPending = false;
+        }
+        else if(rc != Z_OK && rc != Z_BUF_ERROR)
+        {
+            throw ProtocolException(__FILE__, __LINE__, "invalid compressed WebSocket message");
+        }
+        else
+        {
+            //
+            // If the buffer is full, zlib might still have output to write.
+            //
+            _outputPending = _stream->avail_out == 0;
+        }
+    }
+}
+
+bool
+IceInternal::WSInflater::pending() const
+{
+    return _stream->avail_in > 0 || _finish || _outputPending;
+}
+
+#else
+
+IceInternal::WSDeflater::WSDeflater(int, int, bool) :
+    _stream(0),
+    _noContextTakeover(false)
+{
+    throw FeatureNotSupportedException(__FILE__, __LINE__, "WebSocket compression");
+}
+
+IceInternal::WSDeflater::~WSDeflater()
+{
+}
+
+size_t
+IceInternal::WSDeflater::compress(const Byte*, size_t, Byte*, size_t)
+{
+    return 0;
+}
+
+void
+IceInternal::WSDeflater::reset()
+{
+}
+
+IceInternal::WSInflater::WSInflater() :
+    _stream(0),
+    _finish(false),
+    _outputPending(false)
+{
+    throw FeatureNotSupportedException(__FILE__, __LINE__, "WebSocket compression");
+}
+
+IceInternal::WSInflater::~WSInflater()
+{
+}
+
+void
+IceInternal::WSInflater::setInput(const Byte*, size_t)
+{
+}
+
+void
+IceInternal::WSInflater::finishMessage()
+{
+}
+
+bool
+IceInternal::WSInflater::inflate(Buffer&)
+{
+    return true;
+}
+
+bool
+IceInternal::WSInflater::pending() const
+{
+    return false;
+}
+
+#endif
@@ -0,0 +1,119 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_WS_DEFLATE_H
+#define ICE_WS_DEFLATE_H
+
+#include <Ice/Config.h>
+#include <Ice/Buffer.h>
+
+#include <memory>
+#include <string>
+
+struct z_stream_s;
+
+namespace IceInternal
+{
+
+//
+// The parameters of the permessage-deflate WebSocket extension (RFC 7692).
+// A window bits value of 0 means the parameter is not present. A
+// client_max_window_bits parameter without a value is represented by 15.
+//
+struct WSDeflateParameters
+{
+    WSDeflateParameters();
+
+    int serverMaxWindowBits;
+    int clientMaxWindowBits;
+    bool serverNoContextTakeover;
+    bool clientNoContextTakeover;
+};
+
+//
+// Returns true if permessage-deflate is supported by this build.
+//
+bool wsDeflateSupported();
+
+//
+// Parse a single extension from a Sec-WebSocket-Extensions header field.
+// Returns false if it's not a valid permessage-deflate extension.
+//
+bool parseWSDeflateParameters(const std::string&, WSDeflateParameters&);
+
+//
+// Format the parameters as a permessage-deflate extension for a
+// Sec-WebSocket-Extensions header field.
+//
+std::string formatWSDeflateParameters(const WSDeflateParameters&);
+
+//
+// Compress messages with raw deflate and a sync flush, the trailing
+// 0x00 0x00 0xff 0xff bytes are removed from the output as required by
+// the extension.
+//
+class WSDeflater
+{
+public:
+
+    WSDeflater(int, int, bool);
+    ~WSDeflater();
+
+    //
+    // Compress the given bytes into the output buffer and return the
+    // compressed size. Returns 0 if the compressed data doesn't fit in the
+    // output buffer, the message must then be sent uncompressed.
+    //
+    size_t compress(const Ice::Byte*, size_t, Ice::Byte*, size_t);
+
+private:
+
+    void reset();
+
+    z_stream_s* _stream;
+    const bool _noContextTakeover;
+};
+using WSDeflaterPtr = std::shared_ptr<WSDeflater>;
+
+class WSInflater
+{
+public:
+
+    WSInflater();
+    ~WSInflater();
+
+    //
+    // Set the next compressed bytes of a message. The bytes must remain valid
+    // until they are uncompressed.
+    //
+    void setInput(const Ice::Byte*, size_t);
+
+    //
+    // Add the 0x00 0x00 0xff 0xff bytes removed by the sender after the last
+    // compressed bytes of the message.
+    //
+    void finishMessage();
+
+    //
+    // Uncompress the input into the given buffer. Returns false if the buffer
+    // is full before all the input is uncompressed.
+    //
+    bool inflate(Buffer&);
+
+    //
+    // Returns true if there's input left to uncompress.
+    //
+    bool pending() const;
+
+private:
+
+    z_stream_s* _stream;
+    bool _finish;
+    bool _outputPending;
+};
+using WSInflaterPtr = std::shared_ptr<WSInflater>;
+
+}
+
+#endif
@@ -0,0 +1,159 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/WSMask.h>
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define ICE_WS_MASK_SSE2
+#   include <immintrin.h>
+#endif
+
+//
+// AVX2 is used if the compiler targets it, or with GCC and clang if the
+// processor supports it at runtime.
+//
+#if defined(__AVX2__)
+#   define ICE_WS_MASK_AVX2
+#elif defined(ICE_WS_MASK_SSE2) && (defined(__GNUC__) || defined(__clang__)) && \
+      (defined(__x86_64__) || defined(__i386__))
+#   define ICE_WS_MASK_AVX2
+#   define ICE_WS_MASK_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+#ifndef ICE_WS_MASK_AVX2_TARGET
+#   define ICE_WS_MASK_AVX2_TARGET
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+//
+// Rotate the mask so that key[0] applies to the byte at the given offset.
+//
+inline void
+rotateMask(Byte key[4], const Byte* mask, size_t offset)
+{
+    for(size_t i = 0; i < 4; ++i)
+    {
+        key[i] = mask[(offset + i) % 4];
+    }
+}
+
+#ifdef ICE_WS_MASK_SSE2
+size_t
+maskSSE2(Byte* dst, const Byte* src, size_t size, const Byte key[4])
+{
+    int32_t k;
+    memcpy(&k, key, sizeof(k));
+    const __m128i m = _mm_set1_epi32(k);
+
+    size_t n = 0;
+    for(; n + 16 <= size; n += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + n));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + n), _mm_xor_si128(v, m));
+    }
+    return n;
+}
+#endif
+
+#ifdef ICE_WS_MASK_AVX2
+ICE_WS_MASK_AVX2_TARGET size_t
+maskAVX2(Byte* dst, const Byte* src, size_t size, const Byte key[4])
+{
+    int32_t k;
+    memcpy(&k, key, sizeof(k));
+    const __m256i m = _mm256_set1_epi32(k);
+
+    size_t n = 0;
+    for(; n + 64 <= size; n += 64)
+    {
+        __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + n));
+        __m256i v2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + n + 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + n), _mm256_xor_si256(v1, m));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + n + 32), _mm256_xor_si256(v2, m));
+    }
+    for(; n + 32 <= size; n += 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + n));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + n), _mm256_xor_si256(v, m));
+    }
+    return n;
+}
+
+bool
+hasAVX2()
+{
+#if defined(__AVX2__)
+    return true;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+const bool useAVX2 = hasAVX2();
+#endif
+
+//
+// Mask 8 bytes at a time, the vector loops above end with this for the
+// remaining bytes. Offsets multiple of 4 don't change the rotated key.
+//
+void
+maskWords(Byte* dst, const Byte* src, size_t size, const Byte key[4])
+{
+    Byte key8[8];
+    memcpy(key8, key, 4);
+    memcpy(key8 + 4, key, 4);
+    uint64_t k;
+    memcpy(&k, key8, sizeof(k));
+
+    size_t n = 0;
+    for(; n + 8 <= size; n += 8)
+    {
+        uint64_t v;
+        memcpy(&v, src + n, sizeof(v));
+        v ^= k;
+        memcpy(dst + n, &v, sizeof(v));
+    }
+    for(; n < size; ++n)
+    {
+        dst[n] = src[n] ^ key[n % 4];
+    }
+}
+
+}
+
+void
+IceInternal::wsMask(Byte* dst, const Byte* src, size_t size, const Byte* mask, size_t offset)
+{
+    Byte key[4];
+    rotateMask(key, mask, offset);
+
+    size_t n = 0;
+#ifdef ICE_WS_MASK_AVX2
+    if(useAVX2)
+    {
+        n = maskAVX2(dst, src, size, key);
+    }
+#endif
+#ifdef ICE_WS_MASK_SSE2
+    n += maskSSE2(dst + n, src + n, size - n, key);
+#endif
+    maskWords(dst + n, src + n, size - n, key);
+}
+
+void
+IceInternal::wsMaskScalar(Byte* dst, const Byte* src, size_t size, const Byte* mask, size_t offset)
+{
+    Byte key[4];
+    rotateMask(key, mask, offset);
+    maskWords(dst, src, size, key);
+}
@@ -0,0 +1,27 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#ifndef ICE_WS_MASK_H
+#define ICE_WS_MASK_H
+
+#include <Ice/Config.h>
+
+namespace IceInternal
+{
+
+//
+// Apply the 4-byte WebSocket mask to the given number of bytes from the
+// source buffer and store the result in the destination buffer, which can
+// be the source buffer. The offset is the position of the first byte in the
+// frame payload, it's used to select the mask byte to start with.
+//
+// wsMask uses SSE2 or AVX2 when available, wsMaskScalar is the portable
+// implementation.
+//
+ICE_API void wsMask(Ice::Byte*, const Ice::Byte*, size_t, const Ice::Byte*, size_t);
+ICE_API void wsMaskScalar(Ice::Byte*, const Ice::Byte*, size_t, const Ice::Byte*, size_t);
+
+}
+
+#endif
@@ -7,10 +7,13 @@
 #include <Ice/Connection.h>
 #include <Ice/ProtocolInstance.h>
 #include <Ice/HttpParser.h>
+#include <Ice/WSMask.h>
 #include <Ice/Communicator.h>
 #include <Ice/LoggerUtil.h>
 #include <Ice/Buffer.h>
 #include <Ice/LocalException.h>
+#include <Ice/Properties.h>
+#include <Ice/Protocol.h>
 #include <Ice/Base64.h>
 #include <IceUtil/Random.h>
 #include <Ice/SHA1.h>
@@ -43,6 +46,9 @@ using namespace IceInternal;
 #define OP_RES_0xE  0xE     // Reserved
 #define OP_RES_0xF  0xF     // Reserved
 #define FLAG_FINAL  0x80    // Last frame
+#define FLAG_RSV1   0x40    // Compressed message (permessage-deflate)
+#define FLAG_RSV2   0x20    // Reserved
+#define FLAG_RSV3   0x10    // Reserved
 #define FLAG_MASKED 0x80    // Payload is masked
 
 #define CLOSURE_NORMAL         1000
@@ -122,6 +128,25 @@ int64_t ice_nlltoh(const Byte* src)
     return v;
 }
 
+//
+// The permessage-deflate parameters offered by the client or accepted by the
+// server. The compressor window is never smaller than 9 bits, zlib doesn't
+// support 8 bits with raw deflate.
+//
+WSDeflateParameters
+getDeflateParameters(const ProtocolInstancePtr& instance)
+{
+    const PropertiesPtr& properties = instance->properties();
+    WSDeflateParameters params;
+    params.serverMaxWindowBits =
+        max(9, min(15, properties->getPropertyAsIntWithDefault("Ice.WS.Deflate.ServerMaxWindowBits", 15)));
+    params.clientMaxWindowBits =
+        max(9, min(15, properties->getPropertyAsIntWithDefault("Ice.WS.Deflate.ClientMaxWindowBits", 15)));
+    params.serverNoContextTakeover = properties->getPropertyAsInt("Ice.WS.Deflate.ServerNoContextTakeover") > 0;
+    params.clientNoContextTakeover = properties->getPropertyAsInt("Ice.WS.Deflate.ClientNoContextTakeover") > 0;
+    return params;
+}
+
 }
 
 NativeInfoPtr
@@ -180,8 +205,23 @@ IceInternal::WSTransceiver::initialize(Buffer& readBuffer, Buffer& writeBuffer)
                     << "Upgrade: websocket\r\n"
                     << "Connection: Upgrade\r\n"
                     << "Sec-WebSocket-Protocol: " << _iceProtocol << "\r\n"
-                    << "Sec-WebSocket-Version: 13\r\n"
-                    << "Sec-WebSocket-Key: ";
+                    << "Sec-WebSocket-Version: 13\r\n";
+
+                //
+                // Offer the permessage-deflate extension with our parameters. The
+                // server window is only included if it's smaller than the default.
+                //
+                if(_deflateEnabled)
+                {
+                    WSDeflateParameters offer = _deflateParams;
+                    if(offer.serverMaxWindowBits == 15)
+                    {
+                        offer.serverMaxWindowBits = 0;
+                    }
+                    out << "Sec-WebSocket-Extensions: " << formatWSDeflateParameters(offer) << "\r\n";
+                }
+
+                out << "Sec-WebSocket-Key: ";
 
                 //
                 // The value for Sec-WebSocket-Key is a 16-byte random number,
@@ -498,6 +538,78 @@ IceInternal::WSTransceiver::write(Buffer& buf)
     return SocketOperationNone;
 }
 
+SocketOperation
+IceInternal::WSTransceiver::writev(const vector<Buffer*>& bufs)
+{
+    if(_writeStagingBuffer.b.empty())
+    {
+        //
+        // Small messages are copied to the staging buffer, each message in its
+        // own data frame, and written with a single delegate write. This is
+        // only possible if we're not in the middle of writing a frame.
+        //
+        if(_state != StateOpened || _writePending || _writeState != WriteStateHeader)
+        {
+            return Transceiver::writev(bufs);
+        }
+
+        const size_t maxHeaderSize = 14;
+        size_t count = 0;
+        size_t size = 0;
+        for(; count < bufs.size(); ++count)
+        {
+            const Buffer& buf = *bufs[count];
+            if(buf.b.empty() || buf.i != buf.b.begin() || size + maxHeaderSize + buf.b.size() > 16 * 1024 ||
+               (_deflater && buf.b.size() >= _deflateMinSize))
+            {
+                break;
+            }
+            size += maxHeaderSize + buf.b.size();
+        }
+
+        if(count < 2)
+        {
+            return Transceiver::writev(bufs);
+        }
+
+        _writeStagingBuffer.b.resize(size);
+        Buffer::Container::iterator p = _writeStagingBuffer.b.begin();
+        for(size_t n = 0; n < count; ++n)
+        {
+            const Buffer& buf = *bufs[n];
+            p = writeHeader(p, OP_DATA, buf.b.size());
+            if(!_incoming)
+            {
+                wsMask(p, buf.b.begin(), buf.b.size(), _writeMask, 0);
+            }
+            else
+            {
+                memcpy(p, buf.b.begin(), buf.b.size());
+            }
+            p += buf.b.size();
+        }
+        _writeStagingBuffer.b.resize(static_cast<size_t>(p - _writeStagingBuffer.b.begin()));
+        _writeStagingBuffer.i = _writeStagingBuffer.b.begin();
+        _writeStagingCount = count;
+    }
+
+    SocketOperation s = _delegate->write(_writeStagingBuffer);
+    if(s)
+    {
+        return s;
+    }
+
+    assert(_writeStagingCount <= bufs.size());
+    for(size_t n = 0; n < _writeStagingCount; ++n)
+    {
+        bufs[n]->i = bufs[n]->b.end();
+    }
+    _writeStagingBuffer.b.resize(0);
+    _writeStagingBuffer.i = _writeStagingBuffer.b.begin();
+    _writeStagingCount = 0;
+    return Transceiver::writev(bufs);
+}
+
 SocketOperation
 IceInternal::WSTransceiver::read(Buffer& buf)
 {
@@ -531,7 +643,7 @@ IceInternal::WSTransceiver::read(Buffer& buf)
     //
     if(buf.i == buf.b.end())
     {
-        if(_readI < _readBuffer.i)
+        if(_readI < _readBuffer.i || (_inflater && _inflater->pending()))
         {
             _delegate->getNativeInfo()->ready(SocketOperationRead, true);
         }
@@ -543,7 +655,7 @@ IceInternal::WSTransceiver::read(Buffer& buf)
     {
         if(preRead(buf))
         {
-            if(_readState == ReadStatePayload)
+            if(_readState == ReadStatePayload && !_readCompressed)
             {
                 //
                 // If the payload length is smaller than what remains to be read, we read
@@ -579,7 +691,7 @@ IceInternal::WSTransceiver::read(Buffer& buf)
 
     if(buf.i == buf.b.end())
     {
-        if(_readI < _readBuffer.i)
+        if(_readI < _readBuffer.i || (_inflater && _inflater->pending()))
         {
             _delegate->getNativeInfo()->ready(SocketOperationRead, true);
         }
@@ -699,7 +811,7 @@ IceInternal::WSTransceiver::startRead(Buffer& buf)
 
     if(preRead(buf))
     {
-        if(_readState == ReadStatePayload)
+        if(_readState == ReadStatePayload && !_readCompressed)
         {
             //
             // If the payload length is smaller than what remains to be read, we read
@@ -751,7 +863,7 @@ IceInternal::WSTransceiver::finishRead(Buffer& buf)
     {
         // Nothing to do.
     }
-    else if(_readState == ReadStatePayload)
+    else if(_readState == ReadStatePayload && !_readCompressed)
     {
         _delegate->finishRead(buf);
     }
@@ -818,14 +930,21 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _incoming(false),
     _state(StateInitializeDelegate),
     _parser(make_shared<HttpParser>()),
+    _deflateEnabled(wsDeflateSupported() && instance->properties()->getPropertyAsInt("Ice.WS.Deflate") > 0),
+    _deflateParams(getDeflateParameters(instance)),
+    _deflateMinSize(static_cast<size_t>(
+        max(0, instance->properties()->getPropertyAsIntWithDefault("Ice.WS.Deflate.MinSize", 1024)))),
+    _deflateLevel(instance->properties()->getPropertyAsIntWithDefault("Ice.Compression.Level", 1)),
     _readState(ReadStateOpcode),
     _readBufferSize(1024),
     _readLastFrame(true),
     _readOpCode(0),
     _readHeaderLength(0),
     _readPayloadLength(0),
+    _readCompressed(false),
     _writeState(WriteStateHeader),
     _writeBufferSize(16 * 1024),
+    _writeStagingCount(0),
     _readPending(false),
     _writePending(false),
     _closingInitiator(false),
@@ -846,14 +965,21 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _incoming(true),
     _state(StateInitializeDelegate),
     _parser(make_shared<HttpParser>()),
+    _deflateEnabled(wsDeflateSupported() && instance->properties()->getPropertyAsInt("Ice.WS.Deflate") > 0),
+    _deflateParams(getDeflateParameters(instance)),
+    _deflateMinSize(static_cast<size_t>(
+        max(0, instance->properties()->getPropertyAsIntWithDefault("Ice.WS.Deflate.MinSize", 1024)))),
+    _deflateLevel(instance->properties()->getPropertyAsIntWithDefault("Ice.Compression.Level", 1)),
     _readState(ReadStateOpcode),
     _readBufferSize(1024),
     _readLastFrame(true),
     _readOpCode(0),
     _readHeaderLength(0),
     _readPayloadLength(0),
+    _readCompressed(false),
     _writeState(WriteStateHeader),
     _writeBufferSize(1024),
+    _writeStagingCount(0),
     _readPending(false),
     _writePending(false),
     _closingInitiator(false),
@@ -958,6 +1084,16 @@ IceInternal::WSTransceiver::handleRequest(Buffer& responseBuffer)
         throw WebSocketException("invalid value `" + key + "' for WebSocket key");
     }
 
+    //
+    // Accept the permessage-deflate extension if it's offered by the client
+    // and enabled with Ice.WS.Deflate.
+    //
+    string extension;
+    if(_deflateEnabled && _parser->getHeader("Sec-WebSocket-Extensions", val, true))
+    {
+        extension = acceptDeflateOffer(val);
+    }
+
     //
     // Retain the target resource.
     //
@@ -974,6 +1110,10 @@ IceInternal::WSTransceiver::handleRequest(Buffer& responseBuffer)
     {
         out << "Sec-WebSocket-Protocol: " << _iceProtocol << "\r\n";
     }
+    if(!extension.empty())
+    {
+        out << "Sec-WebSocket-Extensions: " << extension << "\r\n";
+    }
 
     //
     // The response includes:
@@ -1091,6 +1231,97 @@ IceInternal::WSTransceiver::handleResponse()
     {
         throw WebSocketException("invalid value `" + val + "' for Sec-WebSocket-Accept");
     }
+
+    //
+    // "If the response includes a |Sec-WebSocket-Extensions| header
+    //  field and this header field indicates the use of an extension
+    //  that was not present in the client's handshake (the server has
+    //  indicated an extension not requested by the client), the client
+    //  MUST _Fail the WebSocket Connection_."
+    //
+    if(_parser->getHeader("Sec-WebSocket-Extensions", val, true))
+    {
+        handleDeflateResponse(val);
+    }
+}
+
+string
+IceInternal::WSTransceiver::acceptDeflateOffer(const string& offers)
+{
+    //
+    // The client can offer several configurations of the extension in order
+    // of preference, we accept the first one we support.
+    //
+    vector<string> extensions;
+    if(!IceUtilInternal::splitString(offers, ",", extensions))
+    {
+        return "";
+    }
+
+    for(vector<string>::const_iterator p = extensions.begin(); p != extensions.end(); ++p)
+    {
+        WSDeflateParameters offer;
+        if(!parseWSDeflateParameters(*p, offer))
+        {
+            continue;
+        }
+
+        int serverWindowBits = _deflateParams.serverMaxWindowBits;
+        if(offer.serverMaxWindowBits > 0)
+        {
+            serverWindowBits = min(serverWindowBits, offer.serverMaxWindowBits);
+            if(serverWindowBits < 9)
+            {
+                continue; // Not supported by zlib.
+            }
+        }
+
+        //
+        // The server must include server_max_window_bits in its response if it's
+        // offered by the client, and can only include client_max_window_bits if
+        // the client offered it.
+        //
+        WSDeflateParameters response;
+        response.serverNoContextTakeover = offer.serverNoContextTakeover || _deflateParams.serverNoContextTakeover;
+        response.clientNoContextTakeover = offer.clientNoContextTakeover || _deflateParams.clientNoContextTakeover;
+        if(offer.serverMaxWindowBits > 0 || serverWindowBits < 15)
+        {
+            response.serverMaxWindowBits = serverWindowBits;
+        }
+        if(offer.clientMaxWindowBits > 0 && min(offer.clientMaxWindowBits, _deflateParams.clientMaxWindowBits) < 15)
+        {
+            response.clientMaxWindowBits = min(offer.clientMaxWindowBits, _deflateParams.clientMaxWindowBits);
+        }
+
+        _deflater = make_shared<WSDeflater>(_deflateLevel, serverWindowBits, response.serverNoContextTakeover);
+        _inflater = make_shared<WSInflater>();
+        return formatWSDeflateParameters(response);
+    }
+    return "";
+}
+
+void
+IceInternal::WSTransceiver::handleDeflateResponse(const string& val)
+{
+    WSDeflateParameters response;
+    if(!_deflateEnabled || !parseWSDeflateParameters(val, response))
+    {
+        throw WebSocketException("invalid value `" + val + "' for Sec-WebSocket-Extensions");
+    }
+
+    int clientWindowBits = _deflateParams.clientMaxWindowBits;
+    if(response.clientMaxWindowBits > 0)
+    {
+        clientWindowBits = min(clientWindowBits, response.clientMaxWindowBits);
+        if(clientWindowBits < 9)
+        {
+            throw WebSocketException("unsupported value `" + val + "' for Sec-WebSocket-Extensions");
+        }
+    }
+
+    _deflater = make_shared<WSDeflater>(_deflateLevel, clientWindowBits,
+                                        response.clientNoContextTakeover || _deflateParams.clientNoContextTakeover);
+    _inflater = make_shared<WSInflater>();
 }
 
 bool
@@ -1116,6 +1347,16 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
             unsigned char ch = static_cast<unsigned char>(*_readI++);
             _readOpCode = ch & 0xf;
 
+            //
+            // The RSV1 bit is only set on the first frame of a compressed message
+            // if permessage-deflate was negotiated. The other reserved bits are
+            // not used.
+            //
+            if((ch & (FLAG_RSV2 | FLAG_RSV3)) || ((ch & FLAG_RSV1) && (!_inflater || _readOpCode != OP_DATA)))
+            {
+                throw ProtocolException(__FILE__, __LINE__, "invalid reserved bits in WebSocket frame");
+            }
+
             //
             // Remember if last frame if we're going to read a data or
             // continuation frame, this is only for protocol
@@ -1128,6 +1369,7 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
                     throw ProtocolException(__FILE__, __LINE__, "invalid data frame, no FIN on previous frame");
                 }
                 _readLastFrame = (ch & FLAG_FINAL) == FLAG_FINAL;
+                _readCompressed = (ch & FLAG_RSV1) == FLAG_RSV1;
             }
             else if(_readOpCode == OP_CONT)
             {
@@ -1229,7 +1471,8 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
                 if(_instance->traceLevel() >= 2)
                 {
                     Trace out(_instance->logger(), _instance->traceCategory());
-                    out << "received " << protocol() << (_readOpCode == OP_DATA ? " data" : " continuation");
+                    out << "received " << protocol() << (_readCompressed ? " compressed" : "");
+                    out << (_readOpCode == OP_DATA ? " data" : " continuation");
                     out << " frame with payload length of " << _readPayloadLength;
                     out << " bytes\n" << toString();
                 }
@@ -1343,6 +1586,63 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
             _readState = ReadStateOpcode;
         }
 
+        if(_readState == ReadStatePayload && _readCompressed)
+        {
+            //
+            // The payload of compressed messages is read in the read buffer and
+            // uncompressed directly in the message buffer. We first uncompress
+            // the bytes already given to the inflater, and give back the control
+            // to the connection once the message buffer is full.
+            //
+            if(!_inflater->inflate(buf) || buf.i == buf.b.end())
+            {
+                _readStart = _readBuffer.i; // Nothing to read.
+                return false;
+            }
+
+            if(_readPayloadLength == 0)
+            {
+                //
+                // We've uncompressed the complete payload, we're ready to read a
+                // new frame.
+                //
+                _readState = ReadStateOpcode;
+                _readCompressed = !_readLastFrame;
+                continue;
+            }
+
+            size_t n = min(static_cast<size_t>(_readBuffer.i - _readI), _readPayloadLength);
+            if(n == 0)
+            {
+                //
+                // Read up to 16KB of the payload at once.
+                //
+                assert(_readI == _readBuffer.i);
+                _readBuffer.b.resize(max(_readBufferSize, min(_readPayloadLength, static_cast<size_t>(16 * 1024))));
+                _readI = _readBuffer.i = _readBuffer.b.begin();
+                _readStart = _readBuffer.i;
+                return true;
+            }
+
+            if(_incoming)
+            {
+                //
+                // Unmask the payload and rotate the mask for the next bytes.
+                //
+                wsMask(_readI, _readI, n, _readMask, 0);
+                rotate(_readMask, _readMask + n % 4, _readMask + 4);
+            }
+
+            _inflater->setInput(_readI, n);
+            _readI += n;
+            _readPayloadLength -= n;
+            if(_readPayloadLength == 0 && _readLastFrame)
+            {
+                _inflater->finishMessage();
+            }
+            continue;
+        }
+
         if(_readState == ReadStatePayload)
         {
             //
@@ -1380,7 +1680,7 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
 bool
 IceInternal::WSTransceiver::postRead(Buffer& buf)
 {
-    if(_readState != ReadStatePayload)
+    if(_readState != ReadStatePayload || _readCompressed)
     {
         return _readStart < _readBuffer.i; // Returns true if data was read.
     }
@@ -1396,11 +1696,8 @@ IceInternal::WSTransceiver::postRead(Buffer& buf)
         //
         // Unmask the data we just read.
         //
-        IceInternal::Buffer::Container::iterator p = _readStart;
-        for(size_t n = static_cast<size_t>(_readStart - _readFrameStart); p < buf.i; ++p, ++n)
-        {
-            *p ^= _readMask[n % 4];
-        }
+        wsMask(_readStart, _readStart, static_cast<size_t>(buf.i - _readStart), _readMask,
+               static_cast<size_t>(_readStart - _readFrameStart));
     }
 
     _readPayloadLength -= static_cast<size_t>(buf.i - _readStart);
@@ -1428,6 +1725,12 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
             }
 
             assert(buf.i == buf.b.begin());
+            if(_deflater && prepareCompressedFrame(buf))
+            {
+                _writeState = WriteStatePayload;
+                _writePayloadLength = buf.b.size();
+                return true;
+            }
             prepareWriteHeader(OP_DATA, buf.b.size());
 
             _writeState = WriteStatePayload;
@@ -1506,11 +1809,10 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
             }
 
             size_t n = static_cast<size_t>(buf.i - buf.b.begin());
-            for(; n < buf.b.size() && _writeBuffer.i < _writeBuffer.b.end(); ++_writeBuffer.i, ++n)
-            {
-                *_writeBuffer.i = buf.b[n] ^ _writeMask[n % 4];
-            }
-            _writePayloadLength = n;
+            size_t length = min(static_cast<size_t>(_writeBuffer.b.end() - _writeBuffer.i), buf.b.size() - n);
+            wsMask(_writeBuffer.i, buf.b.begin() + n, length, _writeMask, n);
+            _writeBuffer.i += length;
+            _writePayloadLength = n + length;
             if(_writeBuffer.i < _writeBuffer.b.end())
             {
                 _writeBuffer.b.resize(static_cast<size_t>(_writeBuffer.i - _writeBuffer.b.begin()));
@@ -1655,6 +1957,48 @@ IceInternal::WSTransceiver::readBuffered(IceInternal::Buffer::Container::size_ty
     return true;
 }
 
+bool
+IceInternal::WSTransceiver::prepareCompressedFrame(Buffer& buf)
+{
+    //
+    // Only messages larger than Ice.WS.Deflate.MinSize are compressed. Messages
+    // compressed with Ice protocol compression are sent uncompressed.
+    //
+    const size_t size = buf.b.size();
+    if(size < _deflateMinSize || (size >= static_cast<size_t>(headerSize) && buf.b[9] >= 2))
+    {
+        return false;
+    }
+
+    //
+    // Compress the message after room for the largest frame header, the header
+    // is written in front of the compressed payload once its size is known. The
+    // message is sent uncompressed if compression doesn't reduce its size.
+    //
+    const size_t maxHeaderSize = 14;
+    _writeBuffer.b.resize(maxHeaderSize + size);
+    Buffer::Container::iterator payload = _writeBuffer.b.begin() + maxHeaderSize;
+    size_t length = _deflater->compress(buf.b.begin(), size, payload, size);
+    if(length == 0)
+    {
+        return false;
+    }
+
+    size_t frameHeaderSize = 2 + (length <= 125 ? 0 : (length <= USHRT_MAX ? 2 : 8)) + (_incoming ? 0 : 4);
+    _writeBuffer.i = payload - frameHeaderSize;
+#ifndef NDEBUG
+    Buffer::Container::iterator p =
+#endif
+        writeHeader(_writeBuffer.i, static_cast<Byte>(OP_DATA | FLAG_RSV1), length);
+    assert(p == payload);
+    if(!_incoming)
+    {
+        wsMask(payload, payload, length, _writeMask, 0);
+    }
+    _writeBuffer.b.resize(maxHeaderSize + length);
+    return true;
+}
+
 void
 IceInternal::WSTransceiver::prepareWriteHeader(Byte opCode, IceInternal::Buffer::Container::size_type payloadLength)
 {
@@ -1662,37 +2006,45 @@ IceInternal::WSTransceiver::prepareWriteHeader(Byte opCode, IceInternal::Buffer:
     // We need to prepare the frame header.
     //
     _writeBuffer.b.resize(_writeBufferSize);
-    _writeBuffer.i = _writeBuffer.b.begin();
+    _writeBuffer.i = writeHeader(_writeBuffer.b.begin(), opCode, payloadLength);
+}
+
+IceInternal::Buffer::Container::iterator
+IceInternal::WSTransceiver::writeHeader(IceInternal::Buffer::Container::iterator p,
+                                        Byte opCode,
+                                        IceInternal::Buffer::Container::size_type payloadLength)
+{
+    IceInternal::Buffer::Container::iterator start = p;
 
     //
     // Set the opcode - this is the one and only data frame.
     //
-    *_writeBuffer.i++ = static_cast<Byte>(opCode | FLAG_FINAL);
+    *p++ = static_cast<Byte>(opCode | FLAG_FINAL);
 
     //
     // Set the payload length.
     //
     if(payloadLength <= 125)
     {
-        *_writeBuffer.i++ = static_cast<Byte>(payloadLength);
+        *p++ = static_cast<Byte>(payloadLength);
     }
     else if(payloadLength > 125 && payloadLength <= USHRT_MAX)
     {
         //
         // Use an extra 16 bits to encode the payload length.
         //
-        *_writeBuffer.i++ = static_cast<Byte>(126);
-        *reinterpret_cast<uint16_t*>(_writeBuffer.i) = htons(static_cast<uint16_t>(payloadLength));
-        _writeBuffer.i += 2;
+        *p++ = static_cast<Byte>(126);
+        *reinterpret_cast<uint16_t*>(p) = htons(static_cast<uint16_t>(payloadLength));
+        p += 2;
     }
     else if(payloadLength > USHRT_MAX)
     {
         //
         // Use an extra 64 bits to encode the payload length.
         //
-        *_writeBuffer.i++ = static_cast<Byte>(127);
-        ice_htonll(static_cast<int64_t>(payloadLength), _writeBuffer.i);
-        _writeBuffer.i += 8;
+        *p++ = static_cast<Byte>(127);
+        ice_htonll(static_cast<int64_t>(payloadLength), p);
+        p += 8;
     }
 
     if(!_incoming)
@@ -1701,9 +2053,10 @@ IceInternal::WSTransceiver::prepareWriteHeader(Byte opCode, IceInternal::Buffer:
         // Add a random 32-bit mask to every outgoing frame, copy the payload data,
         // and apply the mask.
         //
-        _writeBuffer.b[1] |= FLAG_MASKED;
+        start[1] |= FLAG_MASKED;
         IceUtilInternal::generateRandom(reinterpret_cast<char*>(_writeMask), sizeof(_writeMask));
-        memcpy(_writeBuffer.i, _writeMask, sizeof(_writeMask));
-        _writeBuffer.i += sizeof(_writeMask);
+        memcpy(p, _writeMask, sizeof(_writeMask));
+        p += sizeof(_writeMask);
     }
+    return p;
 }
@@ -7,6 +7,7 @@
 
 #include <Ice/ProtocolInstance.h>
 #include <Ice/HttpParser.h>
+#include <Ice/WSDeflate.h>
 
 #include <Ice/LoggerF.h>
 #include <Ice/Transceiver.h>
@@ -37,6 +38,7 @@ public:
     void close() final;
     SocketOperation write(Buffer&) final;
     SocketOperation read(Buffer&) final;
+    SocketOperation writev(const std::vector<Buffer*>&) final;
 #if defined(ICE_USE_IOCP)
     bool startWrite(Buffer&) final;
     void finishWrite(Buffer&) final;
@@ -54,6 +56,10 @@ private:
 
     void handleRequest(Buffer&);
     void handleResponse();
+    std::string acceptDeflateOffer(const std::string&);
+    void handleDeflateResponse(const std::string&);
+
+    bool prepareCompressedFrame(Buffer&);
 
     bool preRead(Buffer&);
     bool postRead(Buffer&);
@@ -63,6 +69,7 @@ private:
 
     bool readBuffered(Buffer::Container::size_type);
     void prepareWriteHeader(Ice::Byte, Buffer::Container::size_type);
+    Buffer::Container::iterator writeHeader(Buffer::Container::iterator, Ice::Byte, Buffer::Container::size_type);
 
     friend class WSConnector;
     friend class WSAcceptor;
@@ -93,6 +100,17 @@ private:
     HttpParserPtr _parser;
     std::string _key;
 
+    //
+    // permessage-deflate configuration and the compressor and decompressor
+    // created if the extension is negotiated.
+    //
+    const bool _deflateEnabled;
+    const WSDeflateParameters _deflateParams;
+    const size_t _deflateMinSize;
+    const int _deflateLevel;
+    WSDeflaterPtr _deflater;
+    WSInflaterPtr _inflater;
+
     enum ReadState
     {
         ReadStateOpcode,
@@ -113,6 +131,7 @@ private:
     Buffer::Container::iterator _readStart;
     Buffer::Container::iterator _readFrameStart;
     unsigned char _readMask[4];
+    bool _readCompressed;
 
     enum WriteState
     {
@@ -126,6 +145,8 @@ private:
     const Buffer::Container::size_type _writeBufferSize;
     unsigned char _writeMask[4];
     size_t _writePayloadLength;
+    Buffer _writeStagingBuffer;
+    size_t _writeStagingCount;
 
     bool _readPending;
     bool _writePending;
@@ -68,7 +68,7 @@ IceSSL::AcceptorI::accept()
         throw PluginInitializationException(__FILE__, __LINE__, "IceSSL: plug-in is not initialized");
     }
 
-    return _instance->engine()->createTransceiver(_instance, _delegate->accept(), _adapterName, true);
+    return _instance->engine()->createTransceiver(_instance, _delegate->accept(), _adapterName, true, "");
 }
 
 string
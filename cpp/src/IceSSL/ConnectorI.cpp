@@ -29,7 +29,12 @@ IceSSL::ConnectorI::connect()
         throw PluginInitializationException(__FILE__, __LINE__, "IceSSL: plug-in is not initialized");
     }
 
-    return _instance->engine()->createTransceiver(_instance, _delegate->connect(), _host, false);
+    //
+    // Sessions are reused with the same server endpoint and host name, a resumed
+    // session isn't verified again.
+    //
+    return _instance->engine()->createTransceiver(_instance, _delegate->connect(), _host, false,
+                                                  _host + "/" + _delegate->toString());
 }
 
 Short
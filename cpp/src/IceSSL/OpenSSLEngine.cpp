@@ -74,6 +74,13 @@ IceSSL_opensslPasswordCallback(char* buf, int size, int flag, void* userData)
     return sz;
 }
 
+int
+IceSSL_opensslNewSessionCallback(SSL* ssl, SSL_SESSION* session)
+{
+    OpenSSL::TransceiverI* p = reinterpret_cast<OpenSSL::TransceiverI*>(SSL_get_ex_data(ssl, 0));
+    return p ? p->newSession(session) : 0;
+}
+
 #ifndef OPENSSL_NO_DH
 DH*
 IceSSL_opensslDHCallback(SSL* ssl, int /*isExport*/, int keyLength)
@@ -104,7 +111,9 @@ passwordError()
 
 OpenSSL::SSLEngine::SSLEngine(const CommunicatorPtr& communicator) :
     IceSSL::SSLEngine(communicator),
-    _ctx(0)
+    _ctx(0),
+    _kernelTLS(false),
+    _sessionReuse(false)
 {
     //
     // Initialize OpenSSL if necessary.
@@ -731,17 +740,54 @@ OpenSSL::SSLEngine::initialize()
         SSL_CTX_set_ex_data(_ctx, 0, this);
 
         //
+        // Session caching is disabled unless IceSSL.SessionCacheSize is set.
         // This is necessary for successful interop with Java. Without it, a Java
         // client would fail to reestablish a connection: the server gets the
         // error "session id context uninitialized" and the client receives
         // "SSLHandshakeException: Remote host closed connection during handshake".
         //
-        SSL_CTX_set_session_cache_mode(_ctx, SSL_SESS_CACHE_OFF);
+        // With IceSSL.SessionReuse, the sessions of outgoing connections are
+        // saved by the new session callback and resumed by the next connection
+        // to the same server endpoint.
+        //
+        const int sessionCacheSize = properties->getPropertyAsInt(propPrefix + "SessionCacheSize");
+        _sessionReuse = properties->getPropertyAsInt(propPrefix + "SessionReuse") > 0;
+        long sessionCacheMode = SSL_SESS_CACHE_OFF;
+        if(sessionCacheSize > 0)
+        {
+            sessionCacheMode |= SSL_SESS_CACHE_SERVER;
+            SSL_CTX_sess_set_cache_size(_ctx, sessionCacheSize);
+        }
+        if(_sessionReuse)
+        {
+            sessionCacheMode |= SSL_SESS_CACHE_CLIENT;
+            SSL_CTX_sess_set_new_cb(_ctx, IceSSL_opensslNewSessionCallback);
+        }
+        SSL_CTX_set_session_cache_mode(_ctx, sessionCacheMode);
+
+        const int sessionTimeout = properties->getPropertyAsInt(propPrefix + "SessionTimeout");
+        if(sessionTimeout > 0)
+        {
+            SSL_CTX_set_timeout(_ctx, sessionTimeout);
+        }
+
+        //
+        // Stateless session tickets are enabled by default. Without tickets, a
+        // session can only be resumed from the server session cache.
+        //
+        if(properties->getPropertyAsIntWithDefault(propPrefix + "SessionTickets", 1) <= 0)
+        {
+            SSL_CTX_set_options(_ctx, SSL_OP_NO_TICKET);
+            if(sessionCacheSize <= 0)
+            {
+                SSL_CTX_set_num_tickets(_ctx, 0);
+            }
+        }
 
         //
-        // Although we disable session caching, we still need to set a session ID
-        // context (ICE-5103). The value can be anything; here we just use the
-        // pointer to this SharedInstance object.
+        // We need to set a session ID context even if session caching is disabled
+        // (ICE-5103). The value can be anything; here we just use the pointer to
+        // this SharedInstance object.
         //
         SSL_CTX_set_session_id_context(_ctx, reinterpret_cast<unsigned char*>(this),
                                         static_cast<unsigned int>(sizeof(this)));
@@ -767,6 +813,21 @@ OpenSSL::SSLEngine::initialize()
             }
         }
 
+        //
+        // Kernel TLS offload. OpenSSL configures the socket for kernel TLS after the
+        // handshake if the kernel supports the negotiated cipher, otherwise the
+        // connection keeps using the user space record layer.
+        //
+        if(properties->getPropertyAsInt(propPrefix + "KernelTLS") > 0)
+        {
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+            SSL_CTX_set_options(_ctx, SSL_OP_ENABLE_KTLS);
+            _kernelTLS = true;
+#else
+            getLogger()->warning("IceSSL: OpenSSL is not configured for kernel TLS");
+#endif
+        }
+
         if(securityTraceLevel() >= 1)
         {
             ostringstream os;
@@ -817,6 +878,52 @@ OpenSSL::SSLEngine::context() const
     return _ctx;
 }
 
+bool
+OpenSSL::SSLEngine::getKernelTLS() const
+{
+    return _kernelTLS;
+}
+
+bool
+OpenSSL::SSLEngine::getSessionReuse() const
+{
+    return _sessionReuse;
+}
+
+SSL_SESSION*
+OpenSSL::SSLEngine::getSession(const string& key)
+{
+    lock_guard lock(_mutex);
+    map<string, SSL_SESSION*>::iterator p = _sessions.find(key);
+    if(p == _sessions.end())
+    {
+        return 0;
+    }
+
+    if(!SSL_SESSION_is_resumable(p->second) ||
+       SSL_SESSION_get_time(p->second) + SSL_SESSION_get_timeout(p->second) < time(0))
+    {
+        SSL_SESSION_free(p->second);
+        _sessions.erase(p);
+        return 0;
+    }
+
+    SSL_SESSION_up_ref(p->second);
+    return p->second;
+}
+
+void
+OpenSSL::SSLEngine::setSession(const string& key, SSL_SESSION* session)
+{
+    lock_guard lock(_mutex);
+    pair<map<string, SSL_SESSION*>::iterator, bool> r = _sessions.insert(make_pair(key, session));
+    if(!r.second)
+    {
+        SSL_SESSION_free(r.first->second);
+        r.first->second = session;
+    }
+}
+
 string
 OpenSSL::SSLEngine::sslErrors() const
 {
@@ -826,6 +933,15 @@ OpenSSL::SSLEngine::sslErrors() const
 void
 OpenSSL::SSLEngine::destroy()
 {
+    {
+        lock_guard lock(_mutex);
+        for(map<string, SSL_SESSION*>::const_iterator p = _sessions.begin(); p != _sessions.end(); ++p)
+        {
+            SSL_SESSION_free(p->second);
+        }
+        _sessions.clear();
+    }
+
     if(_ctx)
     {
         SSL_CTX_free(_ctx);
@@ -837,9 +953,10 @@ IceInternal::TransceiverPtr
 OpenSSL::SSLEngine::createTransceiver(const InstancePtr& instance,
                                       const IceInternal::TransceiverPtr& delegate,
                                       const string& hostOrAdapterName,
-                                      bool incoming)
+                                      bool incoming,
+                                      const string& sessionKey)
 {
-    return make_shared<OpenSSL::TransceiverI>(instance, delegate, hostOrAdapterName, incoming);
+    return make_shared<OpenSSL::TransceiverI>(instance, delegate, hostOrAdapterName, incoming, sessionKey);
 }
 
 #ifndef OPENSSL_NO_DH
@@ -11,6 +11,8 @@
 
 #include <Ice/BuiltinSequences.h>
 
+#include <map>
+
 namespace IceSSL
 {
 
@@ -27,7 +29,8 @@ public:
     void initialize() final;
     void destroy() final;
     IceInternal::TransceiverPtr
-    createTransceiver(const IceSSL::InstancePtr&, const IceInternal::TransceiverPtr&, const std::string&, bool) final;
+    createTransceiver(const IceSSL::InstancePtr&, const IceInternal::TransceiverPtr&, const std::string&, bool,
+                      const std::string&) final;
 
 #ifndef OPENSSL_NO_DH
     DH* dhParams(int);
@@ -36,6 +39,16 @@ public:
     SSL_CTX* context() const;
     void context(SSL_CTX*);
     std::string sslErrors() const;
+    bool getKernelTLS() const;
+
+    //
+    // The sessions of outgoing connections, used to resume a session with the
+    // same server endpoint. getSession returns a new reference to the session,
+    // setSession takes ownership of the given reference.
+    //
+    bool getSessionReuse() const;
+    SSL_SESSION* getSession(const std::string&);
+    void setSession(const std::string&, SSL_SESSION*);
 
 private:
 
@@ -46,6 +59,9 @@ private:
     int parseProtocols(const Ice::StringSeq&) const;
 
     SSL_CTX* _ctx;
+    bool _kernelTLS;
+    bool _sessionReuse;
+    std::map<std::string, SSL_SESSION*> _sessions;
 
 #ifndef OPENSSL_NO_DH
     IceSSL::OpenSSL::DHParamsPtr _dhParams;
@@ -211,6 +211,19 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
         //
         SSL_set_ex_data(_ssl, 0, this);
 
+        //
+        // Resume the last session established with the same server endpoint.
+        //
+        if(!_incoming && _engine->getSessionReuse())
+        {
+            SSL_SESSION* session = _engine->getSession(_sessionKey);
+            if(session)
+            {
+                SSL_set_session(_ssl, session);
+                SSL_SESSION_free(session);
+            }
+        }
+
         //
         // Determine whether a certificate is required from the peer.
         //
@@ -361,6 +374,33 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
         }
     }
 
+    //
+    // The verify callback isn't called when a session is resumed, the certificates
+    // are initialized with the chain sent by the peer when the session was created.
+    // On the server side, the chain doesn't include the peer certificate.
+    //
+    if(SSL_session_reused(_ssl) && _certs.empty())
+    {
+        if(_incoming)
+        {
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+            X509* cert = SSL_get1_peer_certificate(_ssl);
+#else
+            X509* cert = SSL_get_peer_certificate(_ssl);
+#endif
+            if(cert)
+            {
+                _certs.push_back(OpenSSL::Certificate::create(cert));
+            }
+        }
+
+        STACK_OF(X509)* chain = SSL_get_peer_cert_chain(_ssl);
+        for(int i = 0; chain && i < sk_X509_num(chain); ++i)
+        {
+            _certs.push_back(OpenSSL::Certificate::create(X509_dup(sk_X509_value(chain, i))));
+        }
+    }
+
     long result = SSL_get_verify_result(_ssl);
     _trustError = trustStatusToTrustError(result);
     if(result != X509_V_OK)
@@ -391,6 +431,17 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
         _verified = true;
     }
 
+#if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+    //
+    // Kernel TLS requires the socket BIO, it's never enabled with a BIO pair.
+    //
+    if(_engine->getKernelTLS() && !_memBio)
+    {
+        _kernelTLSSend = BIO_get_ktls_send(SSL_get_wbio(_ssl)) > 0;
+        _kernelTLSRecv = BIO_get_ktls_recv(SSL_get_rbio(_ssl)) > 0;
+    }
+#endif
+
     _cipher = SSL_get_cipher_name(_ssl); // Nothing needs to be free'd.
     _engine->verifyPeer(_host, dynamic_pointer_cast<ConnectionInfo>(getInfo()), toString());
 
@@ -414,6 +465,15 @@ OpenSSL::TransceiverI::initialize(IceInternal::Buffer& readBuffer, IceInternal::
             out << "bits = " << SSL_CIPHER_get_bits(cipher, 0) << "\n";
             out << "protocol = " << SSL_get_version(_ssl) << "\n";
         }
+        if(SSL_session_reused(_ssl))
+        {
+            out << "resumed session\n";
+        }
+        if(_engine->getKernelTLS())
+        {
+            out << "kernel TLS send = " << (_kernelTLSSend ? "enabled" : "disabled") << "\n";
+            out << "kernel TLS receive = " << (_kernelTLSRecv ? "enabled" : "disabled") << "\n";
+        }
         out << toString();
     }
 
@@ -477,6 +537,11 @@ OpenSSL::TransceiverI::write(IceInternal::Buffer& buf)
         return IceInternal::SocketOperationNone;
     }
 
+    if(writeToSocket())
+    {
+        return _delegate->write(buf);
+    }
+
     //
     // It's impossible for packetSize to be more than an Int.
     //
@@ -535,6 +600,7 @@ OpenSSL::TransceiverI::write(IceInternal::Buffer& buf)
                 {
                     continue;
                 }
+                _writeRetry = true;
                 return IceInternal::SocketOperationWrite;
             }
             case SSL_ERROR_SYSCALL:
@@ -555,6 +621,7 @@ OpenSSL::TransceiverI::write(IceInternal::Buffer& buf)
                     if(IceInternal::wouldBlock())
                     {
                         assert(SSL_want_write(_ssl));
+                        _writeRetry = true;
                         return IceInternal::SocketOperationWrite;
                     }
                 }
@@ -576,6 +643,7 @@ OpenSSL::TransceiverI::write(IceInternal::Buffer& buf)
             }
         }
 
+        _writeRetry = false;
         buf.i += ret;
 
         if(packetSize > buf.b.end() - buf.i)
@@ -586,6 +654,31 @@ OpenSSL::TransceiverI::write(IceInternal::Buffer& buf)
     return IceInternal::SocketOperationNone;
 }
 
+IceInternal::SocketOperation
+OpenSSL::TransceiverI::writev(const vector<IceInternal::Buffer*>& bufs)
+{
+    //
+    // Coalesce small messages to encrypt them in a single record and write
+    // them with a single system call. OpenSSL requires a write that failed
+    // with SSL_ERROR_WANT_WRITE to be retried with the same buffer, so we
+    // don't start coalescing until the pending write is done.
+    //
+    if(!_connected || _memBio || (_writeRetry && _writeStagingBuffer.b.empty()))
+    {
+        return IceInternal::Transceiver::writev(bufs);
+    }
+
+    //
+    // With kernel TLS, the kernel splits the data in records, so the buffers are
+    // written directly with a single gather write instead of being copied.
+    //
+    if(_writeStagingBuffer.b.empty() && writeToSocket())
+    {
+        return _delegate->writev(bufs);
+    }
+    return writeStaged(bufs, _writeStagingBuffer, 16 * 1024);
+}
+
 IceInternal::SocketOperation
 OpenSSL::TransceiverI::read(IceInternal::Buffer& buf)
 {
@@ -939,23 +1032,44 @@ OpenSSL::TransceiverI::verifyCallback(int ok, X509_STORE_CTX* c)
     return 1;
 }
 
+int
+OpenSSL::TransceiverI::newSession(SSL_SESSION* session)
+{
+    //
+    // Only the sessions of outgoing connections are saved, the server sessions
+    // are stored in the OpenSSL session cache. Returning 1 keeps the reference
+    // to the session.
+    //
+    if(_incoming || _sessionKey.empty() || !_engine->getSessionReuse())
+    {
+        return 0;
+    }
+    _engine->setSession(_sessionKey, session);
+    return 1;
+}
+
 OpenSSL::TransceiverI::TransceiverI(const InstancePtr& instance,
                                     const IceInternal::TransceiverPtr& delegate,
                                     const string& hostOrAdapterName,
-                                    bool incoming) :
+                                    bool incoming,
+                                    const string& sessionKey) :
     _instance(instance),
     _engine(dynamic_pointer_cast<OpenSSL::SSLEngine>(instance->engine())),
     _host(incoming ? "" : hostOrAdapterName),
     _adapterName(incoming ? hostOrAdapterName : ""),
     _incoming(incoming),
+    _sessionKey(sessionKey),
     _delegate(delegate),
     _connected(false),
     _verified(false),
     _ssl(0),
     _memBio(0),
     _sentBytes(0),
+    _writeRetry(false),
     _maxSendPacketSize(0),
-    _maxRecvPacketSize(0)
+    _maxRecvPacketSize(0),
+    _kernelTLSSend(false),
+    _kernelTLSRecv(false)
 {
 }
 
@@ -1013,3 +1127,15 @@ OpenSSL::TransceiverI::send()
     }
     return _writeBuffer.i == _writeBuffer.b.end();
 }
+
+bool
+OpenSSL::TransceiverI::writeToSocket() const
+{
+    //
+    // When the kernel encrypts the data sent over the socket, application data is
+    // written directly to the socket without going through SSL_write. SSL_write is
+    // still used to retry a write which failed with SSL_ERROR_WANT_WRITE, as
+    // required by OpenSSL, and to send a pending TLS 1.3 key update.
+    //
+    return _kernelTLSSend && !_writeRetry && SSL_get_key_update_type(_ssl) == SSL_KEY_UPDATE_NONE;
+}
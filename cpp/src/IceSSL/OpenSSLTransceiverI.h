@@ -31,7 +31,7 @@ class TransceiverI final : public IceInternal::Transceiver
 {
 public:
 
-    TransceiverI(const InstancePtr&, const IceInternal::TransceiverPtr&, const std::string&, bool);
+    TransceiverI(const InstancePtr&, const IceInternal::TransceiverPtr&, const std::string&, bool, const std::string&);
     ~TransceiverI();
     IceInternal::NativeInfoPtr getNativeInfo() final;
 
@@ -40,6 +40,7 @@ public:
     void close() final;
     IceInternal::SocketOperation write(IceInternal::Buffer&) final;
     IceInternal::SocketOperation read(IceInternal::Buffer&) final;
+    IceInternal::SocketOperation writev(const std::vector<IceInternal::Buffer*>&) final;
 #ifdef ICE_USE_IOCP
     bool startWrite(IceInternal::Buffer&) final;
     void finishWrite(IceInternal::Buffer&) final;
@@ -54,11 +55,13 @@ public:
     void setBufferSize(int rcvSize, int sndSize) final;
 
     int verifyCallback(int , X509_STORE_CTX*);
+    int newSession(SSL_SESSION*);
 
 private:
 
     bool receive();
     bool send();
+    bool writeToSocket() const;
 
     friend class IceSSL::OpenSSL::SSLEngine;
 
@@ -67,6 +70,7 @@ private:
     const std::string _host;
     const std::string _adapterName;
     const bool _incoming;
+    const std::string _sessionKey;
     const IceInternal::TransceiverPtr _delegate;
     bool _connected;
     std::string _cipher;
@@ -79,8 +83,12 @@ private:
     IceInternal::Buffer _writeBuffer;
     IceInternal::Buffer _readBuffer;
     int _sentBytes;
+    bool _writeRetry;
+    IceInternal::Buffer _writeStagingBuffer;
     size_t _maxSendPacketSize;
     size_t _maxRecvPacketSize;
+    bool _kernelTLSSend;
+    bool _kernelTLSRecv;
 };
 using TransceiverIPtr = std::shared_ptr<TransceiverI>;
 
@@ -1211,7 +1211,8 @@ IceInternal::TransceiverPtr
 SChannel::SSLEngine::createTransceiver(const InstancePtr& instance,
                                        const IceInternal::TransceiverPtr& delegate,
                                        const string& hostOrAdapterName,
-                                       bool incoming)
+                                       bool incoming,
+                                       const string&)
 {
     return make_shared<SChannel::TransceiverI>(instance, delegate, hostOrAdapterName, incoming);
 }
@@ -44,7 +44,8 @@ public:
     void initialize() final;
 
     IceInternal::TransceiverPtr
-    createTransceiver(const InstancePtr&, const IceInternal::TransceiverPtr&, const std::string&, bool) final;
+    createTransceiver(const InstancePtr&, const IceInternal::TransceiverPtr&, const std::string&, bool,
+                      const std::string&) final;
 
     //
     // Destroy the engine.
@@ -44,10 +44,13 @@ public:
     virtual void destroy() = 0;
 
     //
-    // Create a transceiver using the engine specific implementation
+    // Create a transceiver using the engine specific implementation. The last
+    // argument identifies the target of an outgoing connection for session
+    // resumption, it's empty for incoming connections.
     //
     virtual IceInternal::TransceiverPtr
-    createTransceiver(const InstancePtr&, const IceInternal::TransceiverPtr&, const std::string&, bool) = 0;
+    createTransceiver(const InstancePtr&, const IceInternal::TransceiverPtr&, const std::string&, bool,
+                      const std::string&) = 0;
 
     //
     // Verify peer certificate
@@ -1018,7 +1018,8 @@ IceInternal::TransceiverPtr
 IceSSL::SecureTransport::SSLEngine::createTransceiver(const InstancePtr& instance,
                                                       const IceInternal::TransceiverPtr& delegate,
                                                       const string& hostOrAdapterName,
-                                                      bool incoming)
+                                                      bool incoming,
+                                                      const string&)
 {
     return make_shared<IceSSL::SecureTransport::TransceiverI>(instance, delegate, hostOrAdapterName, incoming);
 }
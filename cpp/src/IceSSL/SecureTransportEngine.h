@@ -28,7 +28,8 @@ public:
     void initialize() final;
     void destroy() final;
     IceInternal::TransceiverPtr
-    createTransceiver(const InstancePtr&, const IceInternal::TransceiverPtr&, const std::string&, bool) final;
+    createTransceiver(const InstancePtr&, const IceInternal::TransceiverPtr&, const std::string&, bool,
+                      const std::string&) final;
 
     SSLContextRef newContext(bool);
     CFArrayRef getCertificateAuthorities() const;
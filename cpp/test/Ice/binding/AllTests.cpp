@@ -9,6 +9,7 @@
 #include <set>
 
 #include <functional>
+#include <chrono>
 
 using namespace std;
 using namespace Test;
@@ -773,6 +774,104 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing connection pool... " << flush;
+    {
+        RemoteObjectAdapterPrxPtr adapter = com->createObjectAdapter("Adapter81", "default");
+        string proxy = communicator->proxyToString(adapter->getTestIntf());
+
+        //
+        // Without a pool, all the requests of a proxy use the same connection.
+        //
+        TestIntfPrxPtr test = Ice::uncheckedCast<TestIntfPrx>(communicator->stringToProxy(proxy));
+        set<string> connections;
+        for(int i = 0; i < 10; ++i)
+        {
+            vector<future<string>> results;
+            for(int j = 0; j < 20; ++j)
+            {
+                results.push_back(test->getConnectionDescriptionAsync());
+            }
+            for(auto& r : results)
+            {
+                connections.insert(r.get());
+            }
+        }
+        test(connections.size() == 1);
+
+        //
+        // With a pool, concurrent requests are striped over up to
+        // Ice.ConnectionPoolSize connections, which are established as the
+        // existing connections get busy.
+        //
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.ConnectionPoolSize", "3");
+        Ice::CommunicatorHolder pooled(initData);
+
+        test = Ice::uncheckedCast<TestIntfPrx>(pooled->stringToProxy(proxy));
+        connections.clear();
+        for(int i = 0; i < 100 && connections.size() < 3; ++i)
+        {
+            vector<future<string>> results;
+            for(int j = 0; j < 20; ++j)
+            {
+                results.push_back(test->getConnectionDescriptionAsync());
+            }
+            for(auto& r : results)
+            {
+                connections.insert(r.get());
+            }
+        }
+        test(connections.size() == 3);
+
+        //
+        // The proxy keeps returning the connection it was bound to.
+        //
+        Ice::ConnectionPtr connection = test->ice_getConnection();
+        for(int i = 0; i < 10; ++i)
+        {
+            test->getConnectionDescription();
+            test(test->ice_getConnection() == connection);
+        }
+
+        com->deactivateObjectAdapter(adapter);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing connection attempt delay... " << flush;
+    {
+        RemoteObjectAdapterPrxPtr adapter = com->createObjectAdapter("Adapter91", "default");
+        TestIntfPrxPtr obj = adapter->getTestIntf();
+
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.ConnectionAttemptDelay", "100");
+        initData.properties->setProperty("Ice.Override.ConnectTimeout", "10000");
+        Ice::CommunicatorHolder racing(initData);
+
+        //
+        // The endpoint of an object adapter which isn't activated accepts
+        // connections but never validates them. The next endpoint is tried
+        // when the connection attempt delay expires.
+        //
+        Ice::ObjectAdapterPtr held = racing->createObjectAdapterWithEndpoints("Held", "default");
+        Ice::EndpointSeq endpoints = held->getEndpoints();
+        Ice::EndpointSeq objEndpoints = obj->ice_getEndpoints();
+        endpoints.insert(endpoints.end(), objEndpoints.begin(), objEndpoints.end());
+
+        TestIntfPrxPtr test = Ice::uncheckedCast<TestIntfPrx>(
+            racing->stringToProxy(communicator->proxyToString(obj))->ice_endpoints(endpoints)->
+                ice_endpointSelection(Ice::EndpointSelectionType::Ordered)->ice_collocationOptimized(false));
+
+        auto start = chrono::steady_clock::now();
+        test(test->getAdapterName() == "Adapter91");
+        test(chrono::steady_clock::now() - start < chrono::seconds(5));
+        test(test->ice_getConnection()->getEndpoint()->toString() == objEndpoints[0]->toString());
+
+        com->deactivateObjectAdapter(adapter);
+    }
+    cout << "ok" << endl;
+
     if(!communicator->getProperties()->getProperty("Ice.Plugin.IceSSL").empty() &&
        communicator->getProperties()->getProperty("Ice.Default.Protocol") == "ssl")
     {
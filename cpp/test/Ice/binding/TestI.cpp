@@ -90,3 +90,9 @@ TestI::getAdapterName(const Ice::Current& current)
 {
     return current.adapter->getName();
 }
+
+std::string
+TestI::getConnectionDescription(const Ice::Current& current)
+{
+    return current.con->toString();
+}
@@ -44,6 +44,7 @@ class TestI : public Test::TestIntf
 public:
 
     virtual std::string getAdapterName(const Ice::Current&);
+    virtual std::string getConnectionDescription(const Ice::Current&);
 };
 
 #endif
@@ -7,6 +7,10 @@
 #include <TestHelper.h>
 #include <TestI.h>
 
+#ifndef _WIN32
+#   include <unistd.h>
+#endif
+
 using namespace std;
 using namespace Test;
 
@@ -94,6 +98,37 @@ allTests(Test::TestHelper* helper)
         rev.major = 1;
         rev.minor = 8;
         test(opaqueEndpoint->rawEncoding == rev);
+
+#ifndef _WIN32
+        Ice::ObjectPrxPtr p2 = communicator->stringToProxy("test:unix -f \"/tmp/ice test:info.sock\" -t 1200 -z");
+        endps = p2->ice_getEndpoints();
+        Ice::UNIXEndpointInfoPtr unixEndpoint = dynamic_pointer_cast<Ice::UNIXEndpointInfo>(endps[0]->getInfo());
+        test(unixEndpoint);
+        test(unixEndpoint->path == "/tmp/ice test:info.sock");
+        test(unixEndpoint->timeout == 1200);
+        test(unixEndpoint->compress);
+        test(!unixEndpoint->datagram());
+        test(!unixEndpoint->secure());
+        test(unixEndpoint->type() == Ice::UNIXEndpointType);
+        test(communicator->stringToProxy(communicator->proxyToString(p2)) == p2);
+#endif
+
+#ifdef __linux__
+        Ice::ObjectPrxPtr p3 = communicator->stringToProxy("test:shm -f /tmp/info.sock -t 1200");
+        endps = p3->ice_getEndpoints();
+        Ice::SHMEndpointInfoPtr shmEndpoint = dynamic_pointer_cast<Ice::SHMEndpointInfo>(endps[0]->getInfo());
+        test(shmEndpoint);
+        test(shmEndpoint->timeout == 1200);
+        test(!shmEndpoint->compress);
+        test(!shmEndpoint->datagram());
+        test(!shmEndpoint->secure());
+        test(shmEndpoint->type() == Ice::SHMEndpointType);
+        unixEndpoint = dynamic_pointer_cast<Ice::UNIXEndpointInfo>(shmEndpoint->underlying);
+        test(unixEndpoint);
+        test(unixEndpoint->path == "/tmp/info.sock");
+        test(communicator->proxyToString(p3) == "test -t -e 1.1:shm -f /tmp/info.sock -t 1200");
+        test(communicator->stringToProxy(communicator->proxyToString(p3)) == p3);
+#endif
     }
     cout << "ok" << endl;
 
@@ -272,6 +307,121 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+#ifndef _WIN32
+    cout << "testing unix endpoint and connection information... " << flush;
+    {
+        ostringstream os;
+        os << "info-" << getpid() << ".sock";
+        string path = os.str();
+
+        communicator->getProperties()->setProperty("UnixAdapter.Endpoints", "unix -f " + path + " -t 15000");
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("UnixAdapter");
+        Ice::EndpointSeq unixEndpoints = adapter->getEndpoints();
+        test(unixEndpoints.size() == 1);
+        test(unixEndpoints == adapter->getPublishedEndpoints());
+
+        Ice::UNIXEndpointInfoPtr unixEndpoint =
+            dynamic_pointer_cast<Ice::UNIXEndpointInfo>(unixEndpoints[0]->getInfo());
+        test(unixEndpoint);
+        test(unixEndpoint->path == path);
+        test(unixEndpoint->timeout == 15000);
+        test(unixEndpoint->type() == Ice::UNIXEndpointType);
+
+        TestIntfPrxPtr prx = Ice::uncheckedCast<TestIntfPrx>(
+            adapter->add(make_shared<TestI>(), Ice::stringToIdentity("test")))->ice_collocationOptimized(false);
+        adapter->activate();
+
+        Ice::ConnectionPtr connection = prx->ice_getConnection();
+        test(connection->type() == "unix");
+        connection->setBufferSize(4096, 8192);
+
+        Ice::UNIXConnectionInfoPtr info = dynamic_pointer_cast<Ice::UNIXConnectionInfo>(connection->getInfo());
+        test(info);
+        test(!info->incoming);
+        test(info->adapterName.empty());
+        test(info->path == path);
+        test(info->uid == static_cast<int>(getuid()));
+        test(info->gid == static_cast<int>(getgid()));
+#ifdef __linux__
+        test(info->pid == static_cast<int>(getpid()));
+#endif
+        test(info->rcvSize >= 4096);
+        test(info->sndSize >= 8192);
+
+        Ice::Context ctx = prx->getConnectionInfoAsContext();
+        test(ctx["incoming"] == "true");
+        test(ctx["adapterName"] == "UnixAdapter");
+        test(ctx["path"] == path);
+        os.str("");
+        os << getuid();
+        test(ctx["uid"] == os.str());
+
+        adapter->destroy();
+        test(access(path.c_str(), F_OK) != 0);
+    }
+    cout << "ok" << endl;
+#endif
+
+#ifdef __linux__
+    cout << "testing shm endpoint and connection information... " << flush;
+    {
+        ostringstream os;
+        os << "info-shm-" << getpid() << ".sock";
+        string path = os.str();
+
+        communicator->getProperties()->setProperty("ShmAdapter.Endpoints", "shm -f " + path + " -t 15000");
+        communicator->getProperties()->setProperty("Ice.SHM.RingSize", "64");
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("ShmAdapter");
+        Ice::EndpointSeq shmEndpoints = adapter->getEndpoints();
+        test(shmEndpoints.size() == 1);
+        test(shmEndpoints == adapter->getPublishedEndpoints());
+
+        Ice::SHMEndpointInfoPtr shmEndpoint = dynamic_pointer_cast<Ice::SHMEndpointInfo>(shmEndpoints[0]->getInfo());
+        test(shmEndpoint);
+        test(shmEndpoint->timeout == 15000);
+        test(shmEndpoint->type() == Ice::SHMEndpointType);
+        Ice::UNIXEndpointInfoPtr unixEndpoint = dynamic_pointer_cast<Ice::UNIXEndpointInfo>(shmEndpoint->underlying);
+        test(unixEndpoint);
+        test(unixEndpoint->path == path);
+
+        TestIntfPrxPtr prx = Ice::uncheckedCast<TestIntfPrx>(
+            adapter->add(make_shared<TestI>(), Ice::stringToIdentity("test")))->ice_collocationOptimized(false);
+        adapter->activate();
+
+        Ice::ConnectionPtr connection = prx->ice_getConnection();
+        test(connection->type() == "shm");
+
+        Ice::SHMConnectionInfoPtr info = dynamic_pointer_cast<Ice::SHMConnectionInfo>(connection->getInfo());
+        test(info);
+        test(!info->incoming);
+        test(info->adapterName.empty());
+        test(info->ringSize == 64 * 1024);
+        Ice::UNIXConnectionInfoPtr unixInfo = dynamic_pointer_cast<Ice::UNIXConnectionInfo>(info->underlying);
+        test(unixInfo);
+        test(unixInfo->path == path);
+        test(unixInfo->pid == static_cast<int>(getpid()));
+
+        Ice::Context ctx = prx->getConnectionInfoAsContext();
+        test(ctx["incoming"] == "true");
+        test(ctx["adapterName"] == "ShmAdapter");
+        test(ctx["ringSize"] == "65536");
+        test(ctx["path"] == path);
+
+        //
+        // Requests larger than the ring buffers are written and read in several
+        // steps.
+        //
+        Ice::Context large;
+        large["data"] = string(200 * 1024 + 17, 'x');
+        ctx = prx->getConnectionInfoAsContext(large);
+        test(ctx["ringSize"] == "65536");
+
+        adapter->destroy();
+        test(access(path.c_str(), F_OK) != 0);
+    }
+    cout << "ok" << endl;
+#endif
+
     testIntf->shutdown();
 
     communicator->shutdown();
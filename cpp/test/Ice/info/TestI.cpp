@@ -92,6 +92,27 @@ TestI::getConnectionInfoAsContext(const Ice::Current& c)
     ctx["incoming"] = info->incoming ? "true" : "false";
     ostringstream os;
 
+    Ice::SHMConnectionInfoPtr shminfo = dynamic_pointer_cast<Ice::SHMConnectionInfo>(info);
+    if(shminfo)
+    {
+        os << shminfo->ringSize;
+        ctx["ringSize"] = os.str();
+        os.str("");
+        info = shminfo->underlying;
+    }
+
+    Ice::UNIXConnectionInfoPtr unixinfo = dynamic_pointer_cast<Ice::UNIXConnectionInfo>(info);
+    if(unixinfo)
+    {
+        ctx["path"] = unixinfo->path;
+        os << unixinfo->pid;
+        ctx["pid"] = os.str();
+        os.str("");
+        os << unixinfo->uid;
+        ctx["uid"] = os.str();
+        return ctx;
+    }
+
     Ice::IPConnectionInfoPtr ipinfo = getIPConnectionInfo(info);
     test(ipinfo);
     ctx["localAddress"] = ipinfo->localAddress;
@@ -579,6 +579,14 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
         test(sm2->receivedBytes - sm1->receivedBytes == requestSz + static_cast<int>(bs.size()) + 4);
         test(sm2->sentBytes - sm1->sentBytes == replySz);
 
+        cm1 = cm2;
+
+        metrics->ice_compress(true)->opByteS(bs); // Zero-filled sequence, highly compressible
+
+        cm2 = dynamic_pointer_cast<IceMX::ConnectionMetrics>(clientMetrics->getMetricsView("View", timestamp)["Connection"][0]);
+        test(cm2->compressionSavedBytes - cm1->compressionSavedBytes > static_cast<int>(bs.size()) / 2);
+        test(cm2->sentBytes - cm1->sentBytes < static_cast<int>(bs.size()) / 2);
+
         props["IceMX.Metrics.View.Map.Connection.GroupBy"] = "state";
         updateProps(clientProps, serverProps, update.get(), props, "Connection");
 
@@ -788,7 +796,133 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
         testAttribute(clientMetrics, clientProps, update.get(), "EndpointLookup", "endpointPort", port, c);
 
         cout << "ok" << endl;
+
+        cout << "testing endpoint lookup cache... " << flush;
+        {
+            Ice::InitializationData initData;
+            initData.properties = communicator->getProperties()->clone();
+            initData.properties->setProperty("Ice.DNSCache.TTL", "60");
+            initData.properties->setProperty("Ice.DNSCache.NegativeTTL", "60");
+            CommunicatorObserverIPtr observer = make_shared<CommunicatorObserverI>();
+            initData.observer = observer;
+            Ice::CommunicatorHolder cached(initData);
+
+            //
+            // The host is only resolved once, further connections use the cached addresses.
+            //
+            prx = cached->stringToProxy("metrics:" + protocol + " -h localhost -t 500 -p " + port);
+            for(int i = 0; i < 3; ++i)
+            {
+                prx->ice_ping();
+                prx->ice_getConnection()->close(Ice::ConnectionClose::GracefullyWithWait);
+            }
+            test(observer->endpointLookupObserver->getTotal() == 1);
+
+            //
+            // Lookup failures are also cached, the retry doesn't resolve the host again.
+            //
+            dnsException = false;
+            for(int i = 0; i < 2; ++i)
+            {
+                try
+                {
+                    cached->stringToProxy("test:tcp -t 500 -h unknownfoo.zeroc.com -p " + port)->ice_ping();
+                    test(false);
+                }
+                catch(const Ice::DNSException&)
+                {
+                    dnsException = true;
+                }
+                catch(const Ice::LocalException&)
+                {
+                    // Some DNS servers don't fail on unknown DNS names.
+                }
+            }
+            test(observer->endpointLookupObserver->getTotal() == 2);
+            test(!dnsException || observer->endpointLookupObserver->getFailedCount() == 1);
+        }
+        cout << "ok" << endl;
+#endif
+
+#if defined(__linux__)
+        cout << "testing thread busy polling... " << flush;
+        {
+            Ice::InitializationData initData;
+            initData.properties = communicator->getProperties()->clone();
+            Ice::PropertyDict metricsProps = initData.properties->getPropertiesForPrefix("IceMX.");
+            for(Ice::PropertyDict::const_iterator p = metricsProps.begin(); p != metricsProps.end(); ++p)
+            {
+                initData.properties->setProperty(p->first, "");
+            }
+            initData.properties->setProperty("IceMX.Metrics.View.GroupBy", "none");
+            initData.properties->setProperty("Ice.ThreadPool.Client.Size", "2");
+            initData.properties->setProperty("Ice.ThreadPool.Client.BusyPoll", "1000");
+            initData.properties->setProperty("Ice.ThreadPool.Client.BusyPollThreads", "2");
+            CommunicatorObserverIPtr observer = make_shared<CommunicatorObserverI>();
+            initData.observer = observer;
+            Ice::CommunicatorPtr polling = Ice::initialize(initData);
+
+            Ice::ObjectPrxPtr polled = polling->stringToProxy("metrics:" + endpoint);
+            for(int i = 0; i < 10; ++i)
+            {
+                polled->ice_ping();
+                polled->ice_pingAsync().get();
+            }
+
+            IceMX::MetricsAdminPtr metricsAdmin =
+                dynamic_pointer_cast<IceMX::MetricsAdmin>(polling->findAdminFacet("Metrics"));
+            view = metricsAdmin->getMetricsView("View", timestamp, Ice::Current());
+            test(view["Thread"].size() == 1);
+            test(dynamic_pointer_cast<IceMX::ThreadMetrics>(view["Thread"][0])->spinTime > 0);
+
+            polling->destroy();
+            test(observer->threadObserver->spinTime > 0);
+        }
+        cout << "ok" << endl;
 #endif
+
+        cout << "testing buffer pool... " << flush;
+        {
+            Ice::InitializationData initData;
+            initData.properties = communicator->getProperties()->clone();
+            Ice::PropertyDict metricsProps = initData.properties->getPropertiesForPrefix("IceMX.");
+            for(Ice::PropertyDict::const_iterator p = metricsProps.begin(); p != metricsProps.end(); ++p)
+            {
+                initData.properties->setProperty(p->first, "");
+            }
+            initData.properties->setProperty("IceMX.Metrics.View.GroupBy", "none");
+            initData.properties->setProperty("Ice.BufferPool", "1");
+
+            //
+            // The replies are read by the thread pool threads and released by
+            // this thread, a small thread cache ensures the released buffers
+            // are moved to the central cache where the thread pool threads
+            // find them.
+            //
+            initData.properties->setProperty("Ice.BufferPool.ThreadCacheSize", "1");
+            CommunicatorObserverIPtr observer = make_shared<CommunicatorObserverI>();
+            initData.observer = observer;
+            Ice::CommunicatorPtr pooled = Ice::initialize(initData);
+
+            Ice::ObjectPrxPtr pooledPrx = pooled->stringToProxy("metrics:" + endpoint);
+            for(int i = 0; i < 100; ++i)
+            {
+                pooledPrx->ice_ping();
+                pooledPrx->ice_pingAsync().get();
+            }
+
+            IceMX::MetricsAdminPtr metricsAdmin =
+                dynamic_pointer_cast<IceMX::MetricsAdmin>(pooled->findAdminFacet("Metrics"));
+            view = metricsAdmin->getMetricsView("View", timestamp, Ice::Current());
+            test(view["Thread"].size() == 1);
+            IceMX::ThreadMetricsPtr threadMetrics = dynamic_pointer_cast<IceMX::ThreadMetrics>(view["Thread"][0]);
+            test(threadMetrics->bufferPoolHits > 0);
+            test(threadMetrics->bufferPoolMisses > 0);
+
+            pooled->destroy();
+            test(observer->threadObserver->bufferPoolHits > 0);
+        }
+        cout << "ok" << endl;
     }
 
     cout << "testing dispatch metrics... " << flush;
@@ -84,6 +84,7 @@ public:
         ObserverI::reset();
         received = 0;
         sent = 0;
+        compressionSaved = 0;
     }
 
     virtual void
@@ -100,8 +101,16 @@ public:
         received += s;
     }
 
+    virtual void
+    compression(std::int32_t s, std::int64_t)
+    {
+        std::lock_guard lock(_mutex);
+        compressionSaved += s;
+    }
+
     std::int32_t sent;
     std::int32_t received;
+    std::int32_t compressionSaved;
 };
 using ConnectionObserverIPtr = std::shared_ptr<ConnectionObserverI>;
 
@@ -115,6 +124,8 @@ public:
         std::lock_guard lock(_mutex);
         ObserverI::reset();
         states = 0;
+        spinTime = 0;
+        bufferPoolHits = 0;
     }
 
     virtual void
@@ -124,7 +135,23 @@ public:
         ++states;
     }
 
+    virtual void
+    busyPoll(std::int64_t s, std::int64_t)
+    {
+        std::lock_guard lock(_mutex);
+        spinTime += s;
+    }
+
+    virtual void
+    bufferPool(std::int32_t hits, std::int32_t)
+    {
+        std::lock_guard lock(_mutex);
+        bufferPoolHits += hits;
+    }
+
     std::int32_t states;
+    std::int64_t spinTime;
+    std::int32_t bufferPoolHits;
 };
 using ThreadObserverIPtr = std::shared_ptr<ThreadObserverI>;
 
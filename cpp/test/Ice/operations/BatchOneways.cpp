@@ -187,6 +187,124 @@ batchOneways(const Test::MyClassPrxPtr& p)
         ic->destroy();
     }
 
+    if(batch->ice_getConnection() &&
+       p->ice_getCommunicator()->getProperties()->getProperty("Ice.Default.Protocol") != "bt")
+    {
+        Ice::InitializationData initData;
+        initData.properties = p->ice_getCommunicator()->getProperties()->clone();
+        initData.properties->setProperty("Ice.BatchAutoFlushDelay", "50");
+        Ice::CommunicatorPtr ic = Ice::initialize(initData);
+
+        //
+        // The batch is flushed by the communicator timer, the requests are below the auto-flush size.
+        //
+        Test::MyClassPrxPtr batch5 =
+            Ice::uncheckedCast<Test::MyClassPrx>(ic->stringToProxy(p->ice_toString()))->ice_batchOneway();
+        p->opByteSOnewayCallCount(); // Reset the call count
+        batch5->opByteSOneway(bs1);
+        batch5->opByteSOneway(bs1);
+        batch5->opByteSOneway(bs1);
+        count = 0;
+        while(count < 3)
+        {
+            count += p->opByteSOnewayCallCount();
+            this_thread::sleep_for(chrono::milliseconds(10));
+        }
+
+        //
+        // Same with the connection batch queue of a fixed proxy.
+        //
+        Test::MyClassPrxPtr batch6 = Ice::uncheckedCast<Test::MyClassPrx>(
+            batch5->ice_getConnection()->createProxy(p->ice_getIdentity())->ice_batchOneway());
+        batch6->opByteSOneway(bs1);
+        batch6->opByteSOneway(bs1);
+        count = 0;
+        while(count < 2)
+        {
+            count += p->opByteSOnewayCallCount();
+            this_thread::sleep_for(chrono::milliseconds(10));
+        }
+
+        //
+        // The proxy properties override the communicator auto-flush delay and size.
+        //
+        ic->getProperties()->setProperty("Batch", p->ice_toString());
+        ic->getProperties()->setProperty("Batch.BatchAutoFlushDelay", "0");
+        ic->getProperties()->setProperty("Batch.BatchAutoFlushSize", "15");
+        Test::MyClassPrxPtr batch7 =
+            Ice::uncheckedCast<Test::MyClassPrx>(ic->propertyToProxy("Batch"))->ice_batchOneway();
+        batch7->opByteSOneway(bs1);
+        this_thread::sleep_for(chrono::milliseconds(200));
+        test(p->opByteSOnewayCallCount() == 0);
+        batch7->opByteSOneway(bs1); // This should trigger the flush of the first request
+        count = 0;
+        while(count < 1)
+        {
+            count += p->opByteSOnewayCallCount();
+            this_thread::sleep_for(chrono::milliseconds(10));
+        }
+        batch7->ice_flushBatchRequests();
+        count = 0;
+        while(count < 1)
+        {
+            count += p->opByteSOnewayCallCount();
+            this_thread::sleep_for(chrono::milliseconds(10));
+        }
+
+        ic->destroy();
+    }
+
+    if(batch->ice_getConnection() &&
+       p->ice_getCommunicator()->getProperties()->getProperty("Ice.Default.Protocol") != "bt")
+    {
+        Ice::InitializationData initData;
+        initData.properties = p->ice_getCommunicator()->getProperties()->clone();
+        initData.properties->setProperty("Ice.BatchPerThread", "1");
+        Ice::CommunicatorPtr ic = Ice::initialize(initData);
+
+        Test::MyClassPrxPtr batch8 =
+            Ice::uncheckedCast<Test::MyClassPrx>(ic->stringToProxy(p->ice_toString()))->ice_batchOneway();
+        Test::MyClassPrxPtr batch9 = Ice::uncheckedCast<Test::MyClassPrx>(
+            batch8->ice_getConnection()->createProxy(p->ice_getIdentity())->ice_batchOneway());
+
+        //
+        // Each thread queues its requests in its own batch, the batches are merged when flushed
+        // by the application or when their total size reaches the auto-flush size.
+        //
+        const int threadCount = 4;
+        const int requestCount = 6;
+        for(const auto& prx : { batch8, batch9 })
+        {
+            p->opByteSOnewayCallCount(); // Reset the call count
+            vector<thread> threads;
+            for(int j = 0; j < threadCount; ++j)
+            {
+                threads.emplace_back([prx, &bs1]()
+                    {
+                        for(int k = 0; k < requestCount; ++k)
+                        {
+                            prx->opByteSOneway(bs1);
+                        }
+                    });
+            }
+            for(auto& t : threads)
+            {
+                t.join();
+            }
+            prx->ice_flushBatchRequests();
+
+            count = 0;
+            while(count < threadCount * requestCount)
+            {
+                count += p->opByteSOnewayCallCount();
+                this_thread::sleep_for(chrono::milliseconds(10));
+            }
+            test(count == threadCount * requestCount);
+        }
+
+        ic->destroy();
+    }
+
     bool supportsCompress = true;
     try
     {
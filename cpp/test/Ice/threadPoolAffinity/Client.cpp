@@ -0,0 +1,275 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Ice.h>
+#include <TestHelper.h>
+
+#include <condition_variable>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <set>
+
+#if defined(__linux__)
+#   include <fstream>
+#   include <sched.h>
+#   include <unistd.h>
+#   include <sys/syscall.h>
+#   include <linux/mempolicy.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+
+namespace
+{
+
+class LoggerI : public Ice::Logger, public std::enable_shared_from_this<LoggerI>
+{
+public:
+
+    virtual void print(const string&)
+    {
+    }
+
+    virtual void trace(const string&, const string&)
+    {
+    }
+
+    virtual void warning(const string& message)
+    {
+        lock_guard<mutex> lock(_mutex);
+        _warnings.push_back(message);
+    }
+
+    virtual void error(const string&)
+    {
+    }
+
+    virtual string getPrefix()
+    {
+        return "LoggerI";
+    }
+
+    virtual Ice::LoggerPtr cloneWithPrefix(const string&)
+    {
+        return shared_from_this();
+    }
+
+    vector<string> warnings()
+    {
+        lock_guard<mutex> lock(_mutex);
+        return _warnings;
+    }
+
+private:
+
+    mutex _mutex;
+    vector<string> _warnings;
+};
+using LoggerIPtr = shared_ptr<LoggerI>;
+
+CommunicatorPtr
+createCommunicator(const LoggerIPtr& logger, const map<string, string>& properties)
+{
+    InitializationData initData;
+    initData.properties = createProperties();
+    initData.properties->setProperty("Ice.ThreadPool.Client.Size", "2");
+    initData.properties->setProperty("Ice.ThreadPool.Client.SizeMax", "2");
+    for(const auto& p : properties)
+    {
+        initData.properties->setProperty(p.first, p.second);
+    }
+    initData.logger = logger;
+    return initialize(initData);
+}
+
+#if defined(__linux__)
+
+set<int>
+getAffinity()
+{
+    set<int> cpus;
+    cpu_set_t cpuSet;
+    test(sched_getaffinity(0, sizeof(cpuSet), &cpuSet) == 0);
+    for(int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+        if(CPU_ISSET(cpu, &cpuSet))
+        {
+            cpus.insert(cpu);
+        }
+    }
+    return cpus;
+}
+
+//
+// Runs work items with the client thread pool threads and returns the CPU
+// affinity of the threads that ran them.
+//
+vector<set<int>>
+getThreadAffinities(const CommunicatorPtr& communicator)
+{
+    const int count = 100;
+    mutex m;
+    condition_variable cv;
+    vector<set<int>> affinities;
+    for(int i = 0; i < count; ++i)
+    {
+        communicator->postToClientThreadPool([&]()
+            {
+                set<int> cpus = getAffinity();
+                lock_guard<mutex> lock(m);
+                affinities.push_back(cpus);
+                if(affinities.size() == count)
+                {
+                    cv.notify_all();
+                }
+            });
+    }
+    unique_lock<mutex> lock(m);
+    cv.wait(lock, [&] { return affinities.size() == count; });
+    return affinities;
+}
+
+#endif
+
+}
+
+class Client : public Test::TestHelper
+{
+public:
+
+    virtual void run(int argc, char* argv[]);
+};
+
+void
+Client::run(int, char*[])
+{
+#if defined(__linux__)
+    const set<int> allowed = getAffinity();
+    const int first = *allowed.begin();
+
+    cout << "testing thread pool CPU affinity... " << flush;
+    {
+        LoggerIPtr logger = make_shared<LoggerI>();
+        CommunicatorHolder communicator(createCommunicator(logger,
+            {{ "Ice.ThreadPool.Client.CpuAffinity", to_string(first) }}));
+        for(const auto& cpus : getThreadAffinities(communicator.communicator()))
+        {
+            test(cpus == set<int>({ first }));
+        }
+        test(logger->warnings().empty());
+        test(getAffinity() == allowed);
+    }
+
+    if(allowed.size() >= 2)
+    {
+        const int second = *next(allowed.begin());
+        for(const char* workStealing : { "0", "1" })
+        {
+            LoggerIPtr logger = make_shared<LoggerI>();
+            CommunicatorHolder communicator(createCommunicator(logger,
+                {{ "Ice.ThreadPool.Client.CpuAffinity", " " + to_string(first) + ", " + to_string(second) },
+                 { "Ice.ThreadPool.Client.PinThreads", "1" },
+                 { "Ice.ThreadPool.Client.WorkStealing", workStealing }}));
+            for(const auto& cpus : getThreadAffinities(communicator.communicator()))
+            {
+                test(cpus.size() == 1 && (*cpus.begin() == first || *cpus.begin() == second));
+            }
+            test(logger->warnings().empty());
+        }
+
+        LoggerIPtr logger = make_shared<LoggerI>();
+        CommunicatorHolder communicator(createCommunicator(logger,
+            {{ "Ice.ThreadPool.Client.CpuAffinity", to_string(first) + "-" + to_string(second) }}));
+        for(const auto& cpus : getThreadAffinities(communicator.communicator()))
+        {
+            test(cpus.size() >= 2 && cpus.find(first) != cpus.end() && cpus.find(second) != cpus.end());
+        }
+        test(logger->warnings().empty());
+    }
+
+    {
+        LoggerIPtr logger = make_shared<LoggerI>();
+        CommunicatorHolder communicator(createCommunicator(logger,
+            {{ "Ice.ThreadPool.Client.PinThreads", "1" }}));
+        for(const auto& cpus : getThreadAffinities(communicator.communicator()))
+        {
+            test(cpus.size() == 1 && allowed.find(*cpus.begin()) != allowed.end());
+        }
+        test(logger->warnings().empty());
+    }
+
+    {
+        LoggerIPtr logger = make_shared<LoggerI>();
+        CommunicatorHolder communicator(createCommunicator(logger,
+            {{ "Ice.ThreadPool.Client.CpuAffinity", "0-foo" }}));
+        for(const auto& cpus : getThreadAffinities(communicator.communicator()))
+        {
+            test(cpus == allowed);
+        }
+        test(logger->warnings().size() == 1);
+        test(logger->warnings()[0].find("invalid CPU list `0-foo'") != string::npos);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing thread pool NUMA node... " << flush;
+    {
+        LoggerIPtr logger = make_shared<LoggerI>();
+        CommunicatorHolder communicator(createCommunicator(logger,
+            {{ "Ice.ThreadPool.Client.NumaNode", "100000" }}));
+        for(const auto& cpus : getThreadAffinities(communicator.communicator()))
+        {
+            test(cpus == allowed);
+        }
+        test(logger->warnings().size() == 1);
+        test(logger->warnings()[0].find("NUMA node 100000 doesn't exist") != string::npos);
+    }
+
+    if(ifstream("/sys/devices/system/node/node0/cpulist"))
+    {
+        LoggerIPtr logger = make_shared<LoggerI>();
+        CommunicatorHolder communicator(createCommunicator(logger,
+            {{ "Ice.ThreadPool.Client.NumaNode", "0" }}));
+        mutex m;
+        condition_variable cv;
+        long policy = -1;
+        set<int> cpus;
+        communicator->postToClientThreadPool([&]()
+            {
+                int mode;
+                unsigned long nodeMask[1024 / (8 * sizeof(unsigned long))] = {};
+                if(syscall(SYS_get_mempolicy, &mode, nodeMask, 1024, 0, 0) != 0)
+                {
+                    mode = -1;
+                }
+                lock_guard<mutex> lock(m);
+                cpus = getAffinity();
+                policy = mode == MPOL_PREFERRED && (nodeMask[0] & 1) ? 1 : 0;
+                cv.notify_all();
+            });
+        unique_lock<mutex> lock(m);
+        cv.wait(lock, [&] { return policy != -1; });
+        test(policy == 1);
+        test(!cpus.empty());
+        for(int cpu : cpus)
+        {
+            test(allowed.find(cpu) != allowed.end());
+        }
+        test(logger->warnings().empty());
+    }
+    cout << "ok" << endl;
+#else
+    cout << "testing thread pool CPU affinity... " << flush;
+    {
+        LoggerIPtr logger = make_shared<LoggerI>();
+        CommunicatorHolder communicator(createCommunicator(logger, {{ "Ice.ThreadPool.Client.CpuAffinity", "0" }}));
+        test(logger->warnings().size() == 1);
+        test(logger->warnings()[0].find("not supported on this platform") != string::npos);
+    }
+    cout << "ok" << endl;
+#endif
+}
+
+DEFINE_TEST(Client)
@@ -0,0 +1,206 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/Ice.h>
+#include <TestHelper.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace Ice;
+
+namespace
+{
+
+CommunicatorPtr
+createCommunicator(int threads, bool workStealing)
+{
+    InitializationData initData;
+    initData.properties = createProperties();
+    initData.properties->setProperty("Ice.ThreadPool.Client.Size", to_string(threads));
+    initData.properties->setProperty("Ice.ThreadPool.Client.SizeMax", to_string(threads));
+    initData.properties->setProperty("Ice.ThreadPool.Client.WorkStealing", workStealing ? "1" : "0");
+    return initialize(initData);
+}
+
+//
+// Keeps a number of work items in flight in the client thread pool: each work
+// item posts the next one from the thread pool thread that runs it, until the
+// given number of work items ran.
+//
+class DispatchChain
+{
+public:
+
+    DispatchChain(const CommunicatorPtr& communicator, int total) :
+        _communicator(communicator),
+        _total(total),
+        _posted(0),
+        _executed(0)
+    {
+    }
+
+    void post()
+    {
+        if(_posted++ < _total)
+        {
+            _communicator->postToClientThreadPool([this]() { executed(); });
+        }
+    }
+
+    void wait()
+    {
+        unique_lock<mutex> lock(_mutex);
+        _conditionVariable.wait(lock, [this] { return _executed == _total; });
+    }
+
+private:
+
+    void executed()
+    {
+        post();
+        if(++_executed == _total)
+        {
+            lock_guard<mutex> lock(_mutex);
+            _conditionVariable.notify_all();
+        }
+    }
+
+    const CommunicatorPtr _communicator;
+    const int _total;
+    atomic<int> _posted;
+    atomic<int> _executed;
+    mutex _mutex;
+    condition_variable _conditionVariable;
+};
+
+double
+throughput(int threads, bool workStealing, int total)
+{
+    CommunicatorHolder communicator(createCommunicator(threads, workStealing));
+    DispatchChain chain(communicator.communicator(), total);
+    auto start = chrono::steady_clock::now();
+    for(int i = 0; i < threads * 4; ++i)
+    {
+        chain.post();
+    }
+    chain.wait();
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    return total / elapsed.count();
+}
+
+}
+
+class Client : public Test::TestHelper
+{
+public:
+
+    virtual void run(int argc, char* argv[]);
+};
+
+void
+Client::run(int, char*[])
+{
+    cout << "testing work stealing dispatch... " << flush;
+    {
+        CommunicatorPtr communicator = createCommunicator(4, true);
+
+        //
+        // Post work items from this thread and from the thread pool threads,
+        // some of which post more work items.
+        //
+        const int count = 10000;
+        mutex m;
+        condition_variable cv;
+        set<thread::id> threads;
+        atomic<int> executed(0);
+        auto item = [&]()
+        {
+            {
+                lock_guard<mutex> lock(m);
+                threads.insert(this_thread::get_id());
+            }
+            if(++executed == count)
+            {
+                lock_guard<mutex> lock(m);
+                cv.notify_all();
+            }
+        };
+        for(int i = 0; i < count / 4; ++i)
+        {
+            communicator->postToClientThreadPool([&]()
+                {
+                    for(int j = 0; j < 3; ++j)
+                    {
+                        communicator->postToClientThreadPool(item);
+                    }
+                    item();
+                });
+        }
+        {
+            unique_lock<mutex> lock(m);
+            cv.wait(lock, [&] { return executed == count; });
+            test(threads.find(this_thread::get_id()) == threads.end());
+            test(!threads.empty() && threads.size() <= 4);
+        }
+
+        //
+        // Work items posted before the communicator is destroyed run before
+        // destroy returns.
+        //
+        executed = 0;
+        for(int i = 0; i < 1000; ++i)
+        {
+            communicator->postToClientThreadPool([&]() { ++executed; });
+        }
+        communicator->destroy();
+        test(executed == 1000);
+    }
+
+    {
+        //
+        // With a single thread, the work items run in the order they were
+        // posted.
+        //
+        CommunicatorPtr communicator = createCommunicator(1, true);
+        vector<int> order;
+        for(int i = 0; i < 1000; ++i)
+        {
+            communicator->postToClientThreadPool([&order, i]() { order.push_back(i); });
+        }
+        communicator->destroy();
+        test(order.size() == 1000);
+        for(int i = 0; i < 1000; ++i)
+        {
+            test(order[static_cast<size_t>(i)] == i);
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing dispatch throughput... " << flush;
+    {
+        const int total = 10000;
+        vector<pair<double, double>> results;
+        for(int threads = 1; threads <= 64; threads *= 2)
+        {
+            results.push_back(make_pair(throughput(threads, false, total), throughput(threads, true, total)));
+        }
+        cout << "ok" << endl;
+        int threads = 1;
+        for(const auto& p : results)
+        {
+            cout << "threads: " << threads << ", work queue: " << static_cast<int>(p.first)
+                 << " items/s, work stealing: " << static_cast<int>(p.second) << " items/s" << endl;
+            threads *= 2;
+        }
+    }
+}
+
+DEFINE_TEST(Client)
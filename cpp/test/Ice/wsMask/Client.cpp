@@ -0,0 +1,121 @@
+//
+// Copyright (c) ZeroC, Inc. All rights reserved.
+//
+
+#include <Ice/WSMask.h>
+#include <TestHelper.h>
+
+#include <chrono>
+#include <vector>
+
+using namespace std;
+using namespace Ice;
+
+namespace
+{
+
+//
+// The byte at a time masking previously used by the WebSocket transport.
+//
+void
+maskBytes(Byte* dst, const Byte* src, size_t size, const Byte* mask, size_t offset)
+{
+    for(size_t n = 0; n < size; ++n)
+    {
+        dst[n] = src[n] ^ mask[(offset + n) % 4];
+    }
+}
+
+typedef void (*MaskFunction)(Byte*, const Byte*, size_t, const Byte*, size_t);
+
+double
+throughput(MaskFunction f, vector<Byte>& buffer, const Byte* mask, int count)
+{
+    auto start = chrono::steady_clock::now();
+    for(int i = 0; i < count; ++i)
+    {
+        f(&buffer[0], &buffer[0], buffer.size(), mask, static_cast<size_t>(i));
+    }
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    return static_cast<double>(buffer.size()) * count / (1024 * 1024) / elapsed.count();
+}
+
+}
+
+class Client : public Test::TestHelper
+{
+public:
+
+    virtual void run(int argc, char* argv[]);
+};
+
+void
+Client::run(int, char*[])
+{
+    const Byte mask[4] = { 0x12, 0x8f, 0xa5, 0x3c };
+
+    cout << "testing masking... " << flush;
+    {
+        vector<Byte> data(1024 + 64);
+        for(size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<Byte>(i * 7 + 3);
+        }
+
+        //
+        // Check all the sizes up to the vector widths with unaligned buffers
+        // and all the mask offsets, both with a separate destination buffer
+        // and in place.
+        //
+        for(size_t size = 0; size <= 1024; size = size < 160 ? size + 1 : size * 2)
+        {
+            for(size_t align = 0; align < 4; ++align)
+            {
+                for(size_t offset = 0; offset < 8; ++offset)
+                {
+                    const Byte* src = &data[align];
+                    vector<Byte> expected(size + 1, 0xff);
+                    maskBytes(&expected[0], src, size, mask, offset);
+
+                    vector<Byte> result(size + 8, 0xff);
+                    IceInternal::wsMask(&result[align], src, size, mask, offset);
+                    test(equal(expected.begin(), expected.begin() + static_cast<ptrdiff_t>(size),
+                               result.begin() + static_cast<ptrdiff_t>(align)));
+                    test(result[align + size] == 0xff);
+
+                    fill(result.begin(), result.end(), 0xff);
+                    IceInternal::wsMaskScalar(&result[align], src, size, mask, offset);
+                    test(equal(expected.begin(), expected.begin() + static_cast<ptrdiff_t>(size),
+                               result.begin() + static_cast<ptrdiff_t>(align)));
+                    test(result[align + size] == 0xff);
+
+                    vector<Byte> inplace(data);
+                    IceInternal::wsMask(&inplace[align], &inplace[align], size, mask, offset);
+                    test(equal(expected.begin(), expected.begin() + static_cast<ptrdiff_t>(size),
+                               inplace.begin() + static_cast<ptrdiff_t>(align)));
+
+                    //
+                    // Masking again restores the original data.
+                    //
+                    IceInternal::wsMask(&inplace[align], &inplace[align], size, mask, offset);
+                    test(inplace == data);
+                }
+            }
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing masking throughput... " << flush;
+    {
+        vector<Byte> buffer(256 * 1024);
+        const int count = 128;
+        double bytes = throughput(maskBytes, buffer, mask, count);
+        double scalar = throughput(IceInternal::wsMaskScalar, buffer, mask, count);
+        double simd = throughput(IceInternal::wsMask, buffer, mask, count);
+        cout << "ok" << endl;
+        cout << "byte: " << static_cast<int>(bytes) << " MB/s, scalar: " << static_cast<int>(scalar)
+             << " MB/s, vector: " << static_cast<int>(simd) << " MB/s" << endl;
+    }
+}
+
+DEFINE_TEST(Client)
@@ -154,104 +154,173 @@ private:
 };
 using DestroyTaskPtr = std::shared_ptr<DestroyTask>;
 
-class Client : public Test::TestHelper
-{
-public:
-
-    void run(int argc, char* argv[]);
-
-};
-
 void
-Client::run(int, char*[])
+testTimer(const IceUtil::TimerPtr& timer, bool sequential = true)
 {
-    cout << "testing timer... " << flush;
     {
-        auto timer = make_shared<IceUtil::Timer>();
+        TestTaskPtr task = make_shared<TestTask>();
+        timer->schedule(task, chrono::seconds::zero());
+        task->waitForRun();
+        task->clear();
+        //
+        // Verify that the same task cannot be scheduled more than once.
+        //
+        timer->schedule(task, chrono::milliseconds(100));
+        try
         {
-            TestTaskPtr task = make_shared<TestTask>();
             timer->schedule(task, chrono::seconds::zero());
-            task->waitForRun();
-            task->clear();
-            //
-            // Verify that the same task cannot be scheduled more than once.
-            //
-            timer->schedule(task, chrono::milliseconds(100));
-            try
-            {
-                timer->schedule(task, chrono::seconds::zero());
-            }
-            catch(const IceUtil::IllegalArgumentException&)
-            {
-                // Expected.
-            }
-            task->waitForRun();
-            task->clear();
         }
-
+        catch(const IceUtil::IllegalArgumentException&)
         {
-            TestTaskPtr task = make_shared<TestTask>();
-            test(!timer->cancel(task));
-            timer->schedule(task, chrono::seconds(1));
-            test(!task->hasRun() && timer->cancel(task) && !task->hasRun());
-            test(!timer->cancel(task));
-            this_thread::sleep_for(chrono::milliseconds(1100));
-            test(!task->hasRun());
+            // Expected.
         }
+        task->waitForRun();
+        task->clear();
+    }
 
+    {
+        TestTaskPtr task = make_shared<TestTask>();
+        test(!timer->cancel(task));
+        timer->schedule(task, chrono::seconds(1));
+        test(!task->hasRun() && timer->cancel(task) && !task->hasRun());
+        test(!timer->cancel(task));
+        this_thread::sleep_for(chrono::milliseconds(1100));
+        test(!task->hasRun());
+    }
+
+    {
+        vector<TestTaskPtr> tasks;
+        auto start = chrono::steady_clock::now() + chrono::milliseconds(500);
+        for(int i = 0; i < 20; ++i)
         {
-            vector<TestTaskPtr> tasks;
-            auto start = chrono::steady_clock::now() + chrono::milliseconds(500);
-            for(int i = 0; i < 20; ++i)
-            {
-                tasks.push_back(make_shared<TestTask>(chrono::milliseconds(500 + i * 50)));
-            }
+            tasks.push_back(make_shared<TestTask>(chrono::milliseconds(500 + i * 50)));
+        }
 
-            IceUtilInternal::shuffle(tasks.begin(), tasks.end());
-            vector<TestTaskPtr>::const_iterator p;
-            for(p = tasks.begin(); p != tasks.end(); ++p)
-            {
-                timer->schedule(*p, (*p)->getScheduledTime());
-            }
+        IceUtilInternal::shuffle(tasks.begin(), tasks.end());
+        vector<TestTaskPtr>::const_iterator p;
+        for(p = tasks.begin(); p != tasks.end(); ++p)
+        {
+            timer->schedule(*p, (*p)->getScheduledTime());
+        }
 
-            for(p = tasks.begin(); p != tasks.end(); ++p)
-            {
-                (*p)->waitForRun();
-            }
+        for(p = tasks.begin(); p != tasks.end(); ++p)
+        {
+            (*p)->waitForRun();
+        }
 
-            test(chrono::steady_clock::now() > start);
+        test(chrono::steady_clock::now() > start);
 
-            sort(tasks.begin(), tasks.end(), TargetLess<shared_ptr<TestTask>>());
-            for(p = tasks.begin(); p + 1 != tasks.end(); ++p)
+        //
+        // Tasks of different timing wheel shards run in different threads,
+        // the order in which they run is only checked with a single thread.
+        //
+        sort(tasks.begin(), tasks.end(), TargetLess<shared_ptr<TestTask>>());
+        for(p = tasks.begin(); sequential && p + 1 != tasks.end(); ++p)
+        {
+            if((*p)->getRunTime() > (*(p + 1))->getRunTime())
             {
-                if((*p)->getRunTime() > (*(p + 1))->getRunTime())
-                {
-                    test(false);
-                }
+                test(false);
             }
         }
+    }
 
-        {
-            TestTaskPtr task = make_shared<TestTask>();
-            timer->scheduleRepeated(task, chrono::milliseconds(20));
-            this_thread::sleep_for(chrono::milliseconds(500));
-            test(task->hasRun());
-            test(task->getCount() > 1);
-            test(task->getCount() < 26);
-            test(timer->cancel(task));
-            int count = task->getCount();
-            this_thread::sleep_for(chrono::milliseconds(100));
-            test(count == task->getCount() || count + 1 == task->getCount());
-        }
+    {
+        TestTaskPtr task = make_shared<TestTask>();
+        timer->scheduleRepeated(task, chrono::milliseconds(20));
+        this_thread::sleep_for(chrono::milliseconds(500));
+        test(task->hasRun());
+        test(task->getCount() > 1);
+        test(task->getCount() < 26);
+        test(timer->cancel(task));
+        int count = task->getCount();
+        this_thread::sleep_for(chrono::milliseconds(100));
+        test(count == task->getCount() || count + 1 == task->getCount());
+    }
 
-        timer->destroy();
+    timer->destroy();
+}
+
+void
+testTimerWheel(const IceUtil::TimerPtr& timer)
+{
+    //
+    // Schedule many tasks over several levels of the wheel, cancel half of
+    // them and check that the others don't run before their scheduled time.
+    //
+    vector<TestTaskPtr> tasks;
+    for(int i = 0; i < 2000; ++i)
+    {
+        tasks.push_back(make_shared<TestTask>(chrono::milliseconds(100 + IceUtilInternal::random(600))));
+    }
+    auto start = chrono::steady_clock::now();
+    for(const auto& task : tasks)
+    {
+        timer->schedule(task, task->getScheduledTime());
+    }
+    for(size_t i = 0; i < tasks.size(); i += 2)
+    {
+        test(timer->cancel(tasks[i]));
+    }
+    for(size_t i = 1; i < tasks.size(); i += 2)
+    {
+        tasks[i]->waitForRun();
+        test(tasks[i]->getRunTime() - start >= tasks[i]->getScheduledTime());
+        test(!timer->cancel(tasks[i]));
+    }
+    for(size_t i = 0; i < tasks.size(); i += 2)
+    {
+        test(!tasks[i]->hasRun());
+    }
+
+    //
+    // A task scheduled once the wheel is idle again.
+    //
+    this_thread::sleep_for(chrono::milliseconds(300));
+    TestTaskPtr task = make_shared<TestTask>();
+    start = chrono::steady_clock::now();
+    timer->schedule(task, chrono::milliseconds(10));
+    task->waitForRun();
+    test(task->getRunTime() - start >= chrono::milliseconds(10));
+    test(task->getRunTime() - start < chrono::seconds(1));
+
+    timer->destroy();
+}
+
+class Client : public Test::TestHelper
+{
+public:
+
+    void run(int argc, char* argv[]);
+
+};
+
+void
+Client::run(int, char*[])
+{
+    cout << "testing timer... " << flush;
+    {
+        testTimer(make_shared<IceUtil::Timer>());
+    }
+    cout << "ok" << endl;
+
+    cout << "testing timer with timing wheels... " << flush;
+    {
+        testTimer(make_shared<IceUtil::Timer>(1));
+        testTimer(make_shared<IceUtil::Timer>(4), false);
+        testTimerWheel(make_shared<IceUtil::Timer>(1));
+        testTimerWheel(make_shared<IceUtil::Timer>(4));
     }
     cout << "ok" << endl;
 
     cout << "testing timer destroy... " << flush;
+    for(int shards : { 0, 1, 4 })
     {
+        auto createTimer = [shards]()
+            {
+                return shards > 0 ? make_shared<IceUtil::Timer>(shards) : make_shared<IceUtil::Timer>();
+            };
         {
-            auto timer = make_shared<IceUtil::Timer>();
+            auto timer = createTimer();
             DestroyTaskPtr destroyTask = make_shared<DestroyTask>(timer);
             timer->schedule(destroyTask, chrono::seconds::zero());
             destroyTask->waitForRun();
@@ -265,7 +334,7 @@ Client::run(int, char*[])
             }
         }
         {
-            auto timer = make_shared<IceUtil::Timer>();
+            auto timer = createTimer();
             TestTaskPtr testTask = make_shared<TestTask>();
             timer->schedule(testTask, chrono::seconds::zero());
             timer->destroy();
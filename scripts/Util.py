@@ -751,6 +751,7 @@ class Mapping(object):
             # Options bellow are not parsed by the base class by still initialized here for convenience (this
             # avoid having to check the configuration type)
             self.openssl = False
+            self.ioUring = False
             self.browser = ""
             self.worker = False
             self.dotnet = False
@@ -3621,7 +3622,10 @@ class CppMapping(Mapping):
     class Config(Mapping.Config):
         @classmethod
         def getSupportedArgs(self):
-            return ("", ["cpp-config=", "cpp-platform=", "cpp-path=", "openssl"])
+            return (
+                "",
+                ["cpp-config=", "cpp-platform=", "cpp-path=", "openssl", "io-uring"],
+            )
 
         @classmethod
         def usage(self):
@@ -3639,6 +3643,9 @@ class CppMapping(Mapping):
             print(
                 "--openssl                 Run SSL tests with OpenSSL instead of the default platform SSL engine."
             )
+            print(
+                "--io-uring                Run with the io_uring selector for the client and server thread pools (Linux)."
+            )
 
         def __init__(self, options=[]):
             Mapping.Config.__init__(self, options)
@@ -3656,6 +3663,7 @@ class CppMapping(Mapping):
                     "cpp-config": "buildConfig",
                     "cpp-platform": "buildPlatform",
                     "cpp-path": "pathOverride",
+                    "io-uring": "ioUring",
                 },
             )
 
@@ -3667,6 +3675,9 @@ class CppMapping(Mapping):
         if isinstance(process, IceProcess):
             props["Ice.NullHandleAbort"] = True
             props["Ice.PrintStackTraces"] = "1"
+            if current.config.ioUring:
+                props["Ice.ThreadPool.Client.IoUring"] = "1"
+                props["Ice.ThreadPool.Server.IoUring"] = "1"
         return props
 
     def getSSLProps(self, process, current):
@@ -4,7 +4,7 @@
 #
 
 # Enable some tracing to allow investigating test failures
-from Util import ClientServerTestCase, CollocatedTestCase, Mapping, TestSuite
+from Util import ClientServerTestCase, CollocatedTestCase, CppMapping, Mapping, TestSuite
 
 
 traceProps = {"Ice.Trace.Network": 2, "Ice.Trace.Retry": 1, "Ice.Trace.Protocol": 1}
@@ -13,4 +13,14 @@ testcases = [ClientServerTestCase(traceProps=traceProps)]
 if Mapping.getByPath(__name__).hasSource("Ice/ami", "collocated"):
     testcases += [CollocatedTestCase()]
 
+# With C++, also run with the lock-free connection send queue
+if isinstance(Mapping.getByPath(__name__), CppMapping):
+    testcases += [
+        ClientServerTestCase(
+            "client/server with send queue",
+            props={"Ice.SendQueue": 1},
+            traceProps=traceProps,
+        )
+    ]
+
 TestSuite(__name__, testcases, options={"compress": [False], "serialize": [False]})
@@ -0,0 +1,35 @@
+#
+# Copyright (c) ZeroC, Inc. All rights reserved.
+#
+
+
+from Util import (
+    ClientAMDServerTestCase,
+    ClientServerTestCase,
+    CollocatedTestCase,
+    CppMapping,
+    Mapping,
+    TestSuite,
+)
+
+
+testcases = [ClientServerTestCase()]
+if Mapping.getByPath(__name__).hasSource("Ice/operations", "serveramd"):
+    testcases += [ClientAMDServerTestCase()]
+if Mapping.getByPath(__name__).hasSource("Ice/operations", "collocated"):
+    testcases += [CollocatedTestCase()]
+
+# With C++, also run over WebSocket with the permessage-deflate extension
+if isinstance(Mapping.getByPath(__name__), CppMapping):
+    testcases += [
+        ClientServerTestCase(
+            "client/server with WebSocket compression",
+            props={
+                "Ice.Default.Protocol": "ws",
+                "Ice.WS.Deflate": 1,
+                "Ice.WS.Deflate.MinSize": 64,
+            },
+        )
+    ]
+
+TestSuite(__name__, testcases)
@@ -3,7 +3,16 @@
 #
 
 
-from Util import Client, ClientServerTestCase, Server, TestSuite
+from Util import (
+    Client,
+    ClientServerTestCase,
+    CppMapping,
+    Linux,
+    Mapping,
+    Server,
+    TestSuite,
+    platform,
+)
 
 
 class UdpTestCase(ClientServerTestCase):
@@ -22,4 +31,12 @@ class UdpTestCase(ClientServerTestCase):
             self.clients = [Client(args=[5])]
 
 
-TestSuite(__name__, [UdpTestCase()], multihost=False)
+testcases = [UdpTestCase()]
+
+# With C++ on Linux, also run with datagrams received and sent with recvmmsg/sendmmsg
+if isinstance(Mapping.getByPath(__name__), CppMapping) and isinstance(platform, Linux):
+    testcases += [
+        UdpTestCase("client/server with batched datagrams", props={"Ice.UDP.BatchSize": 32})
+    ]
+
+TestSuite(__name__, testcases, multihost=False)